@@ -25,6 +25,10 @@ Please remove when issue is resolved
 #include "Petra_Converters.hpp"
 #include "AztecOO.h"
 
+#include <BelosBlockGmresSolMgr.hpp>
+#include <BelosTpetraAdapter.hpp>
+#include <Ifpack2_RILUK.hpp>
+
 #ifdef ATO_USES_ISOLIB
 #include "Albany_STKDiscretization.hpp"
 #include "STKExtract.hpp"
@@ -661,6 +665,7 @@ Solver(const Teuchos::RCP<Teuchos::ParameterList>& appParams,
       if(rname == "Homogenized Constants Response"){
         hs.name = responseList.get<std::string>("Homogenized Constants Name");
         hs.type = responseList.get<std::string>("Homogenized Constants Type");
+        hs.responseIndex = iResponse;
         responseFound = true; break;
       }
     }
@@ -688,6 +693,30 @@ Solver(const Teuchos::RCP<Teuchos::ParameterList>& appParams,
       hs.homogenizationProblems[iSub] = CreateSubSolver( hs.homogenizationAppParams[iSub], _solverComm);
     }
 
+    // The cell problems differ only in the imposed macroscopic strain and,
+    // for shear columns, in the Dirichlet conditions.  If requested, columns
+    // with the same Dirichlet conditions are solved as one block system.
+    hs.blockSolve = false;
+    if( homogParams.isSublist("Block Solve") ){
+      hs.blockSolveParams = Teuchos::rcp(new Teuchos::ParameterList(homogParams.sublist("Block Solve")));
+      hs.blockSolve = hs.blockSolveParams->get<bool>("Enable", false);
+    }
+    if( hs.blockSolve ){
+      for(int iSub=0; iSub<nHomogSubProblems; iSub++){
+        const Teuchos::ParameterList& bcs = 
+          hs.homogenizationAppParams[iSub]->sublist("Problem").sublist("Dirichlet BCs");
+        int nGroups = hs.blockGroups.size();
+        int iGroup = 0;
+        for(; iGroup<nGroups; iGroup++){
+          const Teuchos::ParameterList& groupBCs = 
+            hs.homogenizationAppParams[hs.blockGroups[iGroup][0]]->sublist("Problem").sublist("Dirichlet BCs");
+          if( Teuchos::haveSameValues(bcs, groupBCs) ) break;
+        }
+        if( iGroup == nGroups ) hs.blockGroups.push_back(std::vector<int>());
+        hs.blockGroups[iGroup].push_back(iSub);
+      }
+    }
+
 
   }
 
@@ -834,6 +863,11 @@ ATOT::Solver::evalModelImpl(Thyra::ModelEvaluatorBase::InArgs<ST> const & in_arg
   for (int iHomog=0; iHomog<numHomogenizationSets; iHomog++){
     const HomogenizationSet& hs = _homogenizationSets[iHomog];
     int numColumns = hs.homogenizationProblems.size();
+    if (hs.blockSolve){
+      int numGroups = hs.blockGroups.size();
+      for (int iGroup=0; iGroup<numGroups; iGroup++)
+        solveHomogenizationBlock(hs, hs.blockGroups[iGroup]);
+    } else
     for (int i=0; i<numColumns; i++){
 
       // enforce PDE constraints
@@ -2073,6 +2107,75 @@ ATOT::Solver::createInputFile( const Teuchos::RCP<Teuchos::ParameterList>& appPa
 
 }
 
+/******************************************************************************/
+void
+ATOT::Solver::solveHomogenizationBlock(const HomogenizationSet& hs, 
+                                       const std::vector<int>& columns) const
+/******************************************************************************/
+{
+#ifdef OUTPUT_TO_SCREEN
+  std::cout << "DEBUG: " << __PRETTY_FUNCTION__ << "\n";
+#endif
+  typedef Tpetra_MultiVector MV;
+  typedef Tpetra_Operator Op;
+  typedef Belos::LinearProblem<ST, MV, Op> LinearProblem;
+
+  // The cell problems are linear, so a single Newton step from zero is the
+  // solution.  Scalar parameters are left at their nominal values.
+  const Teuchos::Array<ParamVec> params;
+  const double time = 0.0;
+
+  int nrhs = columns.size();
+  Teuchos::RCP<Albany::Application> app = hs.homogenizationProblems[columns[0]].app;
+  Teuchos::RCP<const Tpetra_Map> mapT = app->getMapT();
+  Tpetra_Vector x0(mapT, true);
+
+  // one Jacobian fill and one preconditioner for all columns
+  Teuchos::RCP<Tpetra_CrsMatrix> jacT = Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
+  app->computeGlobalJacobianT(0.0, 1.0, 0.0, time, NULL, NULL, x0, params, NULL, *jacT);
+
+  Teuchos::ParameterList iluParams;
+  iluParams.set<int>("fact: iluk level-of-fill", hs.blockSolveParams->get<int>("ILU Fill Level", 0));
+  Teuchos::RCP< Ifpack2::RILUK<Tpetra_RowMatrix> >
+    prec = Teuchos::rcp(new Ifpack2::RILUK<Tpetra_RowMatrix>(jacT));
+  prec->setParameters(iluParams);
+  prec->initialize();
+  prec->compute();
+
+  // the right hand sides differ only in the cell problem forcing
+  Teuchos::RCP<MV> B = Teuchos::rcp(new MV(mapT, nrhs));
+  for(int k=0; k<nrhs; k++){
+    Teuchos::RCP<Tpetra_Vector> b = B->getVectorNonConst(k);
+    hs.homogenizationProblems[columns[k]].app->computeGlobalResidualT(time, NULL, NULL, x0, params, *b);
+  }
+  B->scale(-1.0);
+
+  // block Krylov solve over all right hand sides
+  Teuchos::RCP<MV> X = Teuchos::rcp(new MV(mapT, nrhs, true));
+  Teuchos::RCP<LinearProblem> problem = Teuchos::rcp(new LinearProblem(jacT, X, B));
+  problem->setRightPrec(prec);
+  problem->setProblem();
+
+  Teuchos::RCP<Teuchos::ParameterList> belosParams = 
+    Teuchos::rcp(new Teuchos::ParameterList(hs.blockSolveParams->sublist("Belos")));
+  belosParams->set<int>("Block Size", nrhs);
+  Belos::BlockGmresSolMgr<ST, MV, Op> solver(problem, belosParams);
+  Belos::ReturnType ret = solver.solve();
+
+  if( ret != Belos::Converged && _solverComm->getRank() == 0 ){
+    Teuchos::RCP<Teuchos::FancyOStream> out(Teuchos::VerboseObjectBase::getDefaultOStream());
+    *out << "Warning: block solve of homogenization problem (" << hs.name 
+         << ") did not converge in " << solver.getNumIters() << " iterations." << std::endl;
+  }
+
+  // evaluate the homogenized constants response for each column
+  for(int k=0; k<nrhs; k++){
+    const SolverSubSolver& sub = hs.homogenizationProblems[columns[k]];
+    Teuchos::RCP<Tpetra_Vector> g = ConverterT::getTpetraVector(sub.responses_outT->get_g(hs.responseIndex));
+    sub.app->evaluateResponseT(hs.responseIndex, time, NULL, NULL, *X->getVector(k), params, *g);
+  }
+}
+
 /******************************************************************************/
 Teuchos::RCP<Teuchos::ParameterList> 
 ATOT::Solver::createHomogenizationInputFile( 
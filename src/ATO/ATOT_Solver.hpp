@@ -199,6 +199,10 @@ int responseIndex;
 int homogDim; 
 std::vector<Teuchos::RCP<Teuchos::ParameterList> > homogenizationAppParams;
 std::vector<SolverSubSolver> homogenizationProblems;
+// block solve: columns that share Dirichlet conditions share one operator
+bool blockSolve;
+Teuchos::RCP<Teuchos::ParameterList> blockSolveParams;
+std::vector<std::vector<int> > blockGroups;
 } HomogenizationSet;
 
 std::vector<HomogenizationSet> _homogenizationSets;
@@ -261,6 +265,8 @@ createHomogenizationInputFile(
 
 SolverSubSolverData CreateSubSolverData(const SolverSubSolver& sub) const;
 
+void solveHomogenizationBlock(const HomogenizationSet& hs, const std::vector<int>& columns) const;
+
 };
 
 class SolverSubSolver {
@@ -87,7 +87,10 @@ Albany::Application::Application(const RCP<const Teuchos_Comm> &comm_,
       physicsBasedPreconditioner(false), shapeParamsHaveBeenReset(false),
       morphFromInit(true), perturbBetaForDirichlets(0.0), phxGraphVisDetail(0),
       stateGraphVisDetail(0), params_(params), requires_sdbcs_(false),
-      requires_orig_dbcs_(false), no_dir_bcs_(false), is_schwarz_{schwarz} {
+      requires_orig_dbcs_(false), no_dir_bcs_(false), is_schwarz_{schwarz},
+      capture_states_in_residual(false), states_captured(false),
+      captured_time(0.0), captured_has_xdotT(false),
+      captured_has_xdotdotT(false) {
 #if defined(ALBANY_EPETRA)
   comm = Albany::createEpetraCommFromTeuchosComm(comm_);
 #endif
@@ -116,7 +119,9 @@ Albany::Application::Application(const RCP<const Teuchos_Comm> &comm_)
       physicsBasedPreconditioner(false), shapeParamsHaveBeenReset(false),
       morphFromInit(true), perturbBetaForDirichlets(0.0), phxGraphVisDetail(0),
       stateGraphVisDetail(0), requires_sdbcs_(false), no_dir_bcs_(false),
-      requires_orig_dbcs_(false) {
+      requires_orig_dbcs_(false), capture_states_in_residual(false),
+      states_captured(false), captured_time(0.0), captured_has_xdotT(false),
+      captured_has_xdotdotT(false) {
 #if defined(ALBANY_EPETRA)
   comm = Albany::createEpetraCommFromTeuchosComm(comm_);
 #endif
@@ -859,6 +864,28 @@ void Albany::Application::finalSetUp(
 
   nfm = problem->getNeumannFieldManager();
 
+  // Optionally let the residual field managers save the states as well, so
+  // that observing a converged solution does not need another sweep with the
+  // state field manager. Not done when the reference configuration manager
+  // is active, since it brackets the state field manager evaluation.
+  capture_states_in_residual =
+      problemParams->get("Capture States In Residual", false) &&
+      Teuchos::is_null(rc_mgr);
+  if (capture_states_in_residual) {
+    Teuchos::RCP<PHX::DataLayout> dummy =
+        Teuchos::rcp(new PHX::MDALayout<Dummy>(0));
+    for (int ps = 0; ps < fm.size(); ps++) {
+      std::string elementBlockName = meshSpecs[ps]->ebName;
+      std::vector<std::string> responseIDs_to_require =
+          stateMgr.getResidResponseIDsToRequire(elementBlockName);
+      for (auto const &responseID : responseIDs_to_require) {
+        PHX::Tag<PHAL::AlbanyTraits::Residual::ScalarT> res_response_tag(
+            responseID, dummy);
+        fm[ps]->requireField<PHAL::AlbanyTraits::Residual>(res_response_tag);
+      }
+    }
+  }
+
   if (commT->getRank() == 0) {
     phxGraphVisDetail =
         problemParams->get("Phalanx Graph Visualization Detail", 0);
@@ -1364,6 +1391,9 @@ void Albany::Application::computeGlobalResidualImplT(
 #endif
       }
     }
+
+    if (capture_states_in_residual)
+      captureStateInputsT(this_time, xdotT, xdotdotT, *xT);
   }
 
   // Assemble the residual into a non-overlapping vector
@@ -3195,6 +3225,8 @@ void Albany::Application::evaluateStateFieldManagerT(
   loadBasicWorksetInfoT(workset, current_time);
   workset.fT = overlapped_fT;
 
+  states_captured = false;
+
   // Perform fill via field manager
   if (Teuchos::nonnull(rc_mgr))
     rc_mgr->beginEvaluatingSfm();
@@ -3206,6 +3238,58 @@ void Albany::Application::evaluateStateFieldManagerT(
     rc_mgr->endEvaluatingSfm();
 }
 
+namespace {
+// True if both vectors are missing, or both are present and equal
+bool sameVectorT(const Tpetra_Vector *a, const Tpetra_Vector *b) {
+  if (a == NULL || b == NULL)
+    return a == NULL && b == NULL;
+  if (!a->getMap()->isSameAs(*b->getMap()))
+    return false;
+  Tpetra_Vector diff(*a, Teuchos::Copy);
+  diff.update(1.0, *b, -1.0);
+  return diff.normInf() == 0.0;
+}
+
+// Copy v into the reused vector c, allocating c only the first time or when
+// the map changes. Returns false, leaving c untouched, if v is missing.
+bool captureVectorT(Teuchos::RCP<Tpetra_Vector> &c, const Tpetra_Vector *v) {
+  if (v == NULL)
+    return false;
+  if (Teuchos::is_null(c) || c->getMap() != v->getMap())
+    c = Teuchos::rcp(new Tpetra_Vector(v->getMap(), false));
+  c->assign(*v);
+  return true;
+}
+} // namespace
+
+void Albany::Application::captureStateInputsT(
+    const double current_time, const Teuchos::RCP<const Tpetra_Vector> &xdotT,
+    const Teuchos::RCP<const Tpetra_Vector> &xdotdotT,
+    const Tpetra_Vector &xT) {
+  captured_time = current_time;
+  captureVectorT(captured_xT, &xT);
+  captured_has_xdotT = captureVectorT(captured_xdotT, xdotT.get());
+  captured_has_xdotdotT = captureVectorT(captured_xdotdotT, xdotdotT.get());
+  states_captured = true;
+}
+
+bool Albany::Application::useCapturedStatesT(
+    const double current_time, Teuchos::Ptr<const Tpetra_Vector> xdotT,
+    Teuchos::Ptr<const Tpetra_Vector> xdotdotT, const Tpetra_Vector &xT) {
+  if (!states_captured)
+    return false;
+
+  // The saved states can only be used once, since updateStates() follows
+  states_captured = false;
+
+  return current_time == captured_time &&
+         sameVectorT(captured_xT.get(), &xT) &&
+         sameVectorT(captured_has_xdotT ? captured_xdotT.get() : NULL,
+                     xdotT.get()) &&
+         sameVectorT(captured_has_xdotdotT ? captured_xdotdotT.get() : NULL,
+                     xdotdotT.get());
+}
+
 void Albany::Application::registerShapeParameters() {
   int numShParams = shapeParams.size();
   if (shapeParamNames.size() == 0) {
@@ -4082,6 +4166,10 @@ void Albany::Application::computeGlobalResidualSDBCsImplT(
   TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Residual");
   postRegSetup("Residual");
 
+  // The solution is modified for the Dirichlet conditions before the fill, so
+  // the states saved by this evaluation cannot be matched to a solution
+  states_captured = false;
+
   if (scale != 1.0) {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
                                "'Scaling' sublist not recognized when using SDBCs. \n" <<
@@ -408,6 +408,15 @@ public:
   void evaluateStateFieldManagerT(const double current_time,
                                   const Tpetra_MultiVector &x);
 
+  //! Returns true if the states saved during the last residual evaluation
+  //! correspond to this solution, in which case the state field manager does
+  //! not need to be evaluated before StateManager::updateStates(). Only
+  //! possible with "Capture States In Residual".
+  bool useCapturedStatesT(const double current_time,
+                          Teuchos::Ptr<const Tpetra_Vector> xdot,
+                          Teuchos::Ptr<const Tpetra_Vector> xdotdot,
+                          const Tpetra_Vector &x);
+
   //! Access to number of worksets - needed for working with StateManager
   int getNumWorksets() { return disc->getWsElNodeEqID().size(); }
 
@@ -634,6 +643,11 @@ public:
   Teuchos::RCP<Tpetra_Vector const> const &
   getX() const { return x_; }
 
+  // Used by accelerated Schwarz to expose the relaxed iterate to the
+  // coupled applications.
+  void
+  setX(Teuchos::RCP<Tpetra_Vector const> const & x) { x_ = x; }
+
   Teuchos::RCP<Tpetra_Vector const> const &
   getXdot() const { return xdot_; }
 
@@ -802,6 +816,23 @@ protected:
   bool morphFromInit;
   bool ignore_residual_in_jacobian;
 
+  //! Save the states during residual evaluations, and the inputs of the last
+  //! such evaluation, to skip the state field manager when observing. The
+  //! captured vectors are allocated once and overwritten by each residual.
+  bool capture_states_in_residual;
+  bool states_captured;
+  double captured_time;
+  Teuchos::RCP<Tpetra_Vector> captured_xT;
+  Teuchos::RCP<Tpetra_Vector> captured_xdotT;
+  Teuchos::RCP<Tpetra_Vector> captured_xdotdotT;
+  bool captured_has_xdotT;
+  bool captured_has_xdotdotT;
+
+  void captureStateInputsT(const double current_time,
+                           const Teuchos::RCP<const Tpetra_Vector> &xdotT,
+                           const Teuchos::RCP<const Tpetra_Vector> &xdotdotT,
+                           const Tpetra_Vector &xT);
+
   //! To prevent a singular mass matrix associated with Dirichlet
   //  conditions, optionally add a small perturbation to the diag
   double perturbBetaForDirichlets;
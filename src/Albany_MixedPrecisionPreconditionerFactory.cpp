@@ -0,0 +1,276 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_MixedPrecisionPreconditionerFactory.hpp"
+
+#include "Ifpack2_Factory.hpp"
+#include "Teuchos_TestForException.hpp"
+#include "Thyra_DefaultPreconditioner.hpp"
+
+// The float Tpetra and Ifpack2 classes are only there if Trilinos enables
+// float as a Scalar type.
+#ifdef HAVE_TPETRA_INST_FLOAT
+
+namespace {
+
+typedef Albany::MixedPrecisionPreconditionerFactory::PrecST PrecST;
+typedef Tpetra::CrsMatrix<PrecST, Tpetra_LO, Tpetra_GO, KokkosNode>
+    Prec_CrsMatrix;
+typedef Tpetra::RowMatrix<PrecST, Tpetra_LO, Tpetra_GO, KokkosNode>
+    Prec_RowMatrix;
+typedef Tpetra::MultiVector<PrecST, Tpetra_LO, Tpetra_GO, KokkosNode>
+    Prec_MultiVector;
+typedef Ifpack2::Preconditioner<PrecST, Tpetra_LO, Tpetra_GO, KokkosNode>
+    Prec_Ifpack2;
+
+// Copy the values of A into A_prec, which has the same graph.
+void
+copyValues(const Tpetra_CrsMatrix& A, Prec_CrsMatrix& A_prec)
+{
+  Teuchos::ArrayView<const Tpetra_LO> indices;
+  Teuchos::ArrayView<const ST>        values;
+  Teuchos::Array<PrecST>              prec_values;
+
+  A_prec.resumeFill();
+  Tpetra_LO const num_rows = A.getNodeNumRows();
+  for (Tpetra_LO row = 0; row < num_rows; ++row) {
+    A.getLocalRowView(row, indices, values);
+    prec_values.resize(values.size());
+    for (int i = 0; i < values.size(); ++i) {
+      prec_values[i] = static_cast<PrecST>(values[i]);
+    }
+    A_prec.replaceLocalValues(row, indices, prec_values());
+  }
+  A_prec.fillComplete(A.getDomainMap(), A.getRangeMap());
+}
+
+//
+// Tpetra_Operator applying a single precision preconditioner to double
+// precision vectors. It owns the float copy of the Jacobian so it can be
+// refilled in place.
+//
+class MixedPrecisionOpT : public Tpetra_Operator
+{
+ public:
+  MixedPrecisionOpT(
+      Teuchos::RCP<Prec_CrsMatrix> const& A_prec,
+      Teuchos::RCP<Prec_Ifpack2> const&   prec)
+      : A_prec_(A_prec), prec_(prec)
+  {
+  }
+
+  virtual ~MixedPrecisionOpT() {}
+
+  Teuchos::RCP<Prec_CrsMatrix>
+  getMatrix() const
+  {
+    return A_prec_;
+  }
+
+  Teuchos::RCP<Prec_Ifpack2>
+  getPreconditioner() const
+  {
+    return prec_;
+  }
+
+  virtual void
+  apply(
+      Tpetra_MultiVector const& X,
+      Tpetra_MultiVector&       Y,
+      Teuchos::ETransp          mode  = Teuchos::NO_TRANS,
+      ST                        alpha = Teuchos::ScalarTraits<ST>::one(),
+      ST                        beta  = Teuchos::ScalarTraits<ST>::zero()) const
+  {
+    size_t const num_vecs = X.getNumVectors();
+    if (X_prec_.is_null() || X_prec_->getNumVectors() != num_vecs) {
+      X_prec_ = Teuchos::rcp(
+          new Prec_MultiVector(prec_->getDomainMap(), num_vecs, false));
+      Y_prec_ = Teuchos::rcp(
+          new Prec_MultiVector(prec_->getRangeMap(), num_vecs, false));
+    }
+
+    Tpetra::deep_copy(*X_prec_, X);
+    prec_->apply(*X_prec_, *Y_prec_, mode);
+
+    if (beta == Teuchos::ScalarTraits<ST>::zero()) {
+      Tpetra::deep_copy(Y, *Y_prec_);
+      if (alpha != Teuchos::ScalarTraits<ST>::one()) Y.scale(alpha);
+    } else {
+      Tpetra_MultiVector Y_tmp(Y.getMap(), num_vecs, false);
+      Tpetra::deep_copy(Y_tmp, *Y_prec_);
+      Y.update(alpha, Y_tmp, beta);
+    }
+  }
+
+  virtual bool
+  hasTransposeApply() const
+  {
+    return prec_->hasTransposeApply();
+  }
+
+  virtual Teuchos::RCP<const Tpetra_Map>
+  getDomainMap() const
+  {
+    return prec_->getDomainMap();
+  }
+
+  virtual Teuchos::RCP<const Tpetra_Map>
+  getRangeMap() const
+  {
+    return prec_->getRangeMap();
+  }
+
+ private:
+  Teuchos::RCP<Prec_CrsMatrix> A_prec_;
+
+  Teuchos::RCP<Prec_Ifpack2> prec_;
+
+  mutable Teuchos::RCP<Prec_MultiVector> X_prec_;
+
+  mutable Teuchos::RCP<Prec_MultiVector> Y_prec_;
+};
+
+}  // namespace
+
+Albany::MixedPrecisionPreconditionerFactory::
+MixedPrecisionPreconditionerFactory()
+{
+}
+
+bool
+Albany::MixedPrecisionPreconditionerFactory::isCompatible(
+    const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const
+{
+  Teuchos::RCP<const Tpetra_Operator> const op =
+      ConverterT::getConstTpetraOperator(fwdOpSrc.getOp());
+  return Teuchos::nonnull(
+      Teuchos::rcp_dynamic_cast<const Tpetra_CrsMatrix>(op));
+}
+
+Teuchos::RCP<Thyra::PreconditionerBase<ST>>
+Albany::MixedPrecisionPreconditionerFactory::createPrec() const
+{
+  return Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>);
+}
+
+void
+Albany::MixedPrecisionPreconditionerFactory::initializePrec(
+    const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+    Thyra::PreconditionerBase<ST>*                           prec,
+    const Thyra::ESupportSolveUse /* supportSolveUse */) const
+{
+  Teuchos::RCP<const Tpetra_CrsMatrix> const A =
+      Teuchos::rcp_dynamic_cast<const Tpetra_CrsMatrix>(
+          ConverterT::getConstTpetraOperator(fwdOpSrc->getOp()), true);
+
+  Thyra::DefaultPreconditioner<ST>* const default_prec =
+      dynamic_cast<Thyra::DefaultPreconditioner<ST>*>(prec);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      default_prec == NULL,
+      std::logic_error,
+      "MixedPrecisionPreconditionerFactory requires a "
+      "Thyra::DefaultPreconditioner."
+          << std::endl);
+
+  // Reuse the float matrix and the symbolic setup if the graph is unchanged.
+  Teuchos::RCP<MixedPrecisionOpT> prec_op;
+  Teuchos::RCP<Thyra::LinearOpBase<ST>> const old_op =
+      default_prec->getNonconstUnspecifiedPrecOp();
+  if (Teuchos::nonnull(old_op)) {
+    prec_op = Teuchos::rcp_dynamic_cast<MixedPrecisionOpT>(
+        ConverterT::getTpetraOperator(old_op));
+    if (Teuchos::nonnull(prec_op) &&
+        prec_op->getMatrix()->getCrsGraph() != A->getCrsGraph()) {
+      prec_op = Teuchos::null;
+    }
+  }
+
+  if (Teuchos::is_null(prec_op)) {
+    Teuchos::RCP<Prec_CrsMatrix> const A_prec =
+        Teuchos::rcp(new Prec_CrsMatrix(A->getCrsGraph()));
+    copyValues(*A, *A_prec);
+
+    Teuchos::ParameterList pl = Teuchos::nonnull(paramList_) ?
+        *paramList_ : *getValidParameters();
+    std::string const prec_type = pl.get<std::string>("Prec Type");
+    int const overlap = pl.get<int>("Overlap");
+    Teuchos::RCP<Prec_Ifpack2> const ifpack2_prec =
+        Ifpack2::Factory::create<Prec_RowMatrix>(prec_type, A_prec, overlap);
+    ifpack2_prec->setParameters(pl.sublist("Ifpack2 Settings"));
+    ifpack2_prec->initialize();
+    ifpack2_prec->compute();
+
+    prec_op = Teuchos::rcp(new MixedPrecisionOpT(A_prec, ifpack2_prec));
+  } else {
+    copyValues(*A, *prec_op->getMatrix());
+    prec_op->getPreconditioner()->compute();
+  }
+
+  default_prec->initializeUnspecified(
+      Thyra::createLinearOp(Teuchos::rcp_implicit_cast<Tpetra_Operator>(prec_op)));
+}
+
+void
+Albany::MixedPrecisionPreconditionerFactory::uninitializePrec(
+    Thyra::PreconditionerBase<ST>* /* prec */,
+    Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* /* fwdOpSrc */,
+    Thyra::ESupportSolveUse* /* supportSolveUse */) const
+{
+  // Keep the float matrix around so the next initializePrec can reuse it.
+}
+
+void
+Albany::MixedPrecisionPreconditionerFactory::setParameterList(
+    const Teuchos::RCP<Teuchos::ParameterList>& paramList)
+{
+  paramList->validateParametersAndSetDefaults(*getValidParameters(), 0);
+  paramList_ = paramList;
+}
+
+Teuchos::RCP<Teuchos::ParameterList>
+Albany::MixedPrecisionPreconditionerFactory::getNonconstParameterList()
+{
+  if (Teuchos::is_null(paramList_)) {
+    paramList_ = Teuchos::rcp(new Teuchos::ParameterList(*getValidParameters()));
+  }
+  return paramList_;
+}
+
+Teuchos::RCP<Teuchos::ParameterList>
+Albany::MixedPrecisionPreconditionerFactory::unsetParameterList()
+{
+  Teuchos::RCP<Teuchos::ParameterList> const old = paramList_;
+  paramList_ = Teuchos::null;
+  return old;
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+Albany::MixedPrecisionPreconditionerFactory::getParameterList() const
+{
+  return paramList_;
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+Albany::MixedPrecisionPreconditionerFactory::getValidParameters() const
+{
+  Teuchos::RCP<Teuchos::ParameterList> validPL =
+      Teuchos::rcp(new Teuchos::ParameterList("Mixed Precision Ifpack2"));
+  validPL->set<std::string>(
+      "Prec Type", "RILUK", "Ifpack2 preconditioner built in single precision");
+  validPL->set<int>(
+      "Overlap", 0, "Overlap passed to Ifpack2::Factory, as for \"Ifpack2\"");
+  validPL->sublist("Ifpack2 Settings", false, "Passed to Ifpack2")
+      .disableRecursiveValidation();
+  return validPL;
+}
+
+std::string
+Albany::MixedPrecisionPreconditionerFactory::description() const
+{
+  return "Albany::MixedPrecisionPreconditionerFactory";
+}
+
+#endif // HAVE_TPETRA_INST_FLOAT
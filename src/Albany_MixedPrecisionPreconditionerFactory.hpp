@@ -0,0 +1,84 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_MIXED_PRECISION_PRECONDITIONER_FACTORY_HPP
+#define ALBANY_MIXED_PRECISION_PRECONDITIONER_FACTORY_HPP
+
+#include "Albany_DataTypes.hpp"
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Thyra_PreconditionerFactoryBase.hpp"
+
+namespace Albany {
+
+  //! Stratimikos preconditioner factory building Ifpack2 in single precision
+  /*!
+   * The double precision Jacobian is copied into a float Tpetra::CrsMatrix
+   * that shares its graph, and the Ifpack2 preconditioner (relaxation,
+   * Chebyshev, ILU, ...) is set up and applied in float. The resulting
+   * operator converts its input and output, so the outer Krylov solve stays
+   * in double. On subsequent Jacobians with the same graph only the values
+   * are copied and the numeric setup is redone.
+   *
+   * Registered with Stratimikos as "Mixed Precision Ifpack2". Parameters
+   * are those of the Ifpack2 factory: "Overlap", "Prec Type" and
+   * "Ifpack2 Settings".
+   */
+  class MixedPrecisionPreconditionerFactory :
+    public Thyra::PreconditionerFactoryBase<ST> {
+  public:
+
+    typedef float PrecST;
+
+    //! Constructor
+    MixedPrecisionPreconditionerFactory();
+
+    //! @name Thyra::PreconditionerFactoryBase methods
+    //@{
+
+    bool isCompatible(const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const;
+
+    Teuchos::RCP<Thyra::PreconditionerBase<ST> > createPrec() const;
+
+    void initializePrec(
+      const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >& fwdOpSrc,
+      Thyra::PreconditionerBase<ST>* prec,
+      const Thyra::ESupportSolveUse supportSolveUse) const;
+
+    void uninitializePrec(
+      Thyra::PreconditionerBase<ST>* prec,
+      Teuchos::RCP<const Thyra::LinearOpSourceBase<ST> >* fwdOpSrc,
+      Thyra::ESupportSolveUse* supportSolveUse) const;
+
+    //@}
+
+    //! @name Teuchos::ParameterListAcceptor methods
+    //@{
+
+    void setParameterList(const Teuchos::RCP<Teuchos::ParameterList>& paramList);
+
+    Teuchos::RCP<Teuchos::ParameterList> getNonconstParameterList();
+
+    Teuchos::RCP<Teuchos::ParameterList> unsetParameterList();
+
+    Teuchos::RCP<const Teuchos::ParameterList> getParameterList() const;
+
+    Teuchos::RCP<const Teuchos::ParameterList> getValidParameters() const;
+
+    //@}
+
+    std::string description() const;
+
+  private:
+
+    Teuchos::RCP<Teuchos::ParameterList> paramList_;
+
+  }; // class MixedPrecisionPreconditionerFactory
+
+} // namespace Albany
+
+#endif // ALBANY_MIXED_PRECISION_PRECONDITIONER_FACTORY_HPP
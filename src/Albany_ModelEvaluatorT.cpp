@@ -8,6 +8,8 @@
 
 #include "Albany_ModelEvaluatorT.hpp"
 #include "Albany_DistributedParameterDerivativeOpT.hpp"
+#include "Albany_TangentJacobianOpT.hpp"
+#include "Thyra_DefaultLinearOpSource.hpp"
 #include "Teuchos_ScalarTraits.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Tpetra_ConfigDefs.hpp"
@@ -278,6 +280,41 @@ Albany::ModelEvaluatorT::ModelEvaluatorT(
     }
   }
 
+  // Exact matrix-free Jacobian from the Tangent fill. The assembled
+  // Jacobian is only used to rebuild the preconditioner, every
+  // "Preconditioner Lag" Jacobian evaluations, at each new time, and when
+  // the Krylov iterations of a solve exceed "Rebuild Iteration Ratio" times
+  // those of the first solve with the current preconditioner. Requests for
+  // df/dp, and so parameter sensitivities, are rejected in evalModelImpl.
+  Teuchos::ParameterList& mfParams =
+      problemParams.sublist("AD Matrix-Free Jacobian");
+  use_ad_matrix_free_ = mfParams.get<bool>("Enable", false);
+  prec_lag_ = mfParams.get<int>("Preconditioner Lag", 1);
+  rebuild_prec_on_new_time_ =
+      mfParams.get<bool>("Rebuild Preconditioner On New Time", true);
+  prec_iter_ratio_ = mfParams.get<double>("Rebuild Iteration Ratio", 0.0);
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      prec_lag_ < 1,
+      Teuchos::Exceptions::InvalidParameter,
+      std::endl
+          << "Error!  In Albany::ModelEvaluatorT constructor:  "
+          << "Preconditioner Lag must be at least 1."
+          << std::endl);
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      prec_iter_ratio_ != 0.0 && prec_iter_ratio_ < 1.0,
+      Teuchos::Exceptions::InvalidParameter,
+      std::endl
+          << "Error!  In Albany::ModelEvaluatorT constructor:  "
+          << "Rebuild Iteration Ratio must be 0 (disabled) or at least 1."
+          << std::endl);
+
+  if (use_ad_matrix_free_ == true) {
+    *out << "Using AD matrix-free Jacobian, preconditioner lag = " << prec_lag_
+         << std::endl;
+  }
+
   timer = Teuchos::TimeMonitor::getNewTimer("Albany: **Total Fill Time**");
 }
 
@@ -426,6 +463,12 @@ Albany::ModelEvaluatorT::getUpperBounds() const
 Teuchos::RCP<Thyra::LinearOpBase<ST>>
 Albany::ModelEvaluatorT::create_W_op() const
 {
+  if (use_ad_matrix_free_ == true) {
+    const Teuchos::RCP<Tpetra_Operator> W =
+        Teuchos::rcp(new TangentJacobianOpT(app));
+    return Thyra::createLinearOp(W);
+  }
+
   const Teuchos::RCP<Tpetra_Operator> W =
       Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
   return Thyra::createLinearOp(W);
@@ -434,6 +477,19 @@ Albany::ModelEvaluatorT::create_W_op() const
 Teuchos::RCP<Thyra::PreconditionerBase<ST>>
 Albany::ModelEvaluatorT::create_W_prec() const
 {
+  if (use_ad_matrix_free_ == true) {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        Teuchos::is_null(prec_factory_),
+        std::logic_error,
+        "Error!  AD Matrix-Free Jacobian requires a Stratimikos "
+        "preconditioner to build from the lagged assembled Jacobian."
+            << std::endl);
+
+    Extra_W_crs = Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
+    prec_built_ = false;
+    return prec_factory_->createPrec();
+  }
+
   Teuchos::RCP<Thyra::DefaultPreconditioner<ST>> W_prec =
       Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>);
   Teuchos::RCP<Tpetra_Operator>         precOp = app->getPreconditionerT();
@@ -562,7 +618,7 @@ Albany::ModelEvaluatorT::createOutArgsImpl() const
 
   result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_f, true);
 
-  if (supplies_prec)
+  if (supplies_prec || use_ad_matrix_free_)
     result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec, true);
 
   result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_W_op, true);
@@ -776,10 +832,16 @@ Albany::ModelEvaluatorT::evalModelImpl(
 
   // Cast W to a CrsMatrix, throw an exception if this fails
   const Teuchos::RCP<Tpetra_CrsMatrix> W_op_out_crsT =
-      Teuchos::nonnull(W_op_outT) ?
+      Teuchos::nonnull(W_op_outT) && use_ad_matrix_free_ == false ?
           Teuchos::rcp_dynamic_cast<Tpetra_CrsMatrix>(W_op_outT, true) :
           Teuchos::null;
 
+  // Or to the matrix-free Jacobian
+  const Teuchos::RCP<TangentJacobianOpT> W_op_out_mfT =
+      Teuchos::nonnull(W_op_outT) && use_ad_matrix_free_ == true ?
+          Teuchos::rcp_dynamic_cast<TangentJacobianOpT>(W_op_outT, true) :
+          Teuchos::null;
+
 #ifdef WRITE_MASS_MATRIX_TO_MM_FILE
   // IK, 4/24/15: adding object to hold mass matrix to be written to matrix
   // market file
@@ -833,6 +895,71 @@ Albany::ModelEvaluatorT::evalModelImpl(
         "colmap.mm", *Mass_crs->getColMap());
 #endif
   }
+  if (Teuchos::nonnull(W_op_out_mfT)) {
+    // The applies since the last set() are the Krylov iterations of the
+    // last linear solve. Compare them with the first solve after the last
+    // preconditioner rebuild.
+    int const
+    krylov_iters = W_op_out_mfT->getNumApplies();
+
+    if (prec_iter_ratio_ > 0.0 && prec_built_ == true && krylov_iters > 0) {
+      if (prec_base_iters_ == 0) {
+        prec_base_iters_ = krylov_iters;
+      } else if (krylov_iters > prec_iter_ratio_ * prec_base_iters_) {
+        prec_degraded_ = true;
+      }
+    }
+
+    W_op_out_mfT->set(
+        alpha,
+        beta,
+        omega,
+        curr_time,
+        x_dotT,
+        x_dotdotT,
+        xT,
+        Teuchos::rcpFromRef(sacado_param_vec));
+  }
+  // Lagged preconditioner for the matrix-free Jacobian
+  if (use_ad_matrix_free_ == true && Teuchos::nonnull(outArgsT.get_W_prec())) {
+    bool const
+    new_time = rebuild_prec_on_new_time_ == true && curr_time != prec_time_;
+
+    if (prec_built_ == false || prec_age_ >= prec_lag_ || new_time == true ||
+        prec_degraded_ == true) {
+      if (prec_degraded_ == true) {
+        *Teuchos::VerboseObjectBase::getDefaultOStream()
+            << "Krylov iterations grew from " << prec_base_iters_
+            << ", rebuilding the preconditioner" << std::endl;
+      }
+
+      app->computeGlobalJacobianT(
+          alpha,
+          beta,
+          omega,
+          curr_time,
+          x_dotT.get(),
+          x_dotdotT.get(),
+          *xT,
+          sacado_param_vec,
+          fT_out.get(),
+          *Extra_W_crs,
+          dt);
+      f_already_computed = true;
+
+      const Teuchos::RCP<Tpetra_Operator> jacT = Extra_W_crs;
+      prec_factory_->initializePrec(
+          Thyra::defaultLinearOpSource<ST>(Thyra::createConstLinearOp(jacT)),
+          outArgsT.get_W_prec().ptr());
+
+      prec_built_ = true;
+      prec_age_ = 0;
+      prec_time_ = curr_time;
+      prec_base_iters_ = 0;
+      prec_degraded_ = false;
+    }
+    ++prec_age_;
+  }
   if (Teuchos::nonnull(WPrec_out)) {
     app->computeGlobalJacobianT(
         alpha,
@@ -851,16 +978,39 @@ Albany::ModelEvaluatorT::evalModelImpl(
   }
 
   // df/dp
-  for (int l = 0; l < outArgsT.Np(); ++l) {
-    const Teuchos::RCP<Thyra::MultiVectorBase<ST>> dfdp_out =
-        outArgsT.get_DfDp(l).getMultiVector();
+  // All requested parameter vectors are seeded together so that a single
+  // tangent fill computes every df/dp; the columns of the combined
+  // sensitivity are then copied back to the individual outputs.
+  {
+    Teuchos::Array<int> dfdp_indices;
+    Teuchos::Array<Teuchos::RCP<Tpetra_MultiVector>> dfdp_outTs;
+    for (int l = 0; l < outArgsT.Np(); ++l) {
+      const Teuchos::RCP<Thyra::MultiVectorBase<ST>> dfdp_out =
+          outArgsT.get_DfDp(l).getMultiVector();
 
-    const Teuchos::RCP<Tpetra_MultiVector> dfdp_outT =
-        Teuchos::nonnull(dfdp_out) ?
-            ConverterT::getTpetraMultiVector(dfdp_out) :
-            Teuchos::null;
+      // Sensitivity solves are not set up for the matrix-free Jacobian
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          Teuchos::nonnull(dfdp_out) && use_ad_matrix_free_ == true,
+          std::logic_error,
+          std::endl
+              << "Error!  In Albany::ModelEvaluatorT::evalModelImpl:  "
+              << "AD Matrix-Free Jacobian does not support df/dp, disable "
+              << "it or the sensitivity computation."
+              << std::endl);
 
-    if (Teuchos::nonnull(dfdp_outT)) {
+      const Teuchos::RCP<Tpetra_MultiVector> dfdp_outT =
+          Teuchos::nonnull(dfdp_out) ?
+              ConverterT::getTpetraMultiVector(dfdp_out) :
+              Teuchos::null;
+
+      if (Teuchos::nonnull(dfdp_outT)) {
+        dfdp_indices.push_back(l);
+        dfdp_outTs.push_back(dfdp_outT);
+      }
+    }
+
+    if (dfdp_indices.size() == 1) {
+      const int l = dfdp_indices[0];
       const Teuchos::RCP<ParamVec> p_vec =
           Teuchos::rcpFromRef(sacado_param_vec[l]);
 
@@ -881,9 +1031,59 @@ Albany::ModelEvaluatorT::evalModelImpl(
           NULL,
           fT_out.get(),
           NULL,
-          dfdp_outT.get());
+          dfdp_outTs[0].get());
+
+      f_already_computed = true;
+    } else if (dfdp_indices.size() > 1) {
+      // Concatenate the parameter vectors into one set of tangent seeds
+      const Teuchos::RCP<ParamVec> p_vec = Teuchos::rcp(new ParamVec());
+      for (int i = 0; i < dfdp_indices.size(); ++i) {
+        const ParamVec& p_l = sacado_param_vec[dfdp_indices[i]];
+        for (unsigned int k = 0; k < p_l.size(); ++k)
+          p_vec->addParam(p_l[k].family, p_l[k].baseValue);
+      }
+
+      const Teuchos::RCP<Tpetra_MultiVector> dfdp_allT = Teuchos::rcp(
+          new Tpetra_MultiVector(dfdp_outTs[0]->getMap(), p_vec->size()));
+
+      app->computeGlobalTangentT(
+          0.0,
+          0.0,
+          0.0,
+          curr_time,
+          false,
+          x_dotT.get(),
+          x_dotdotT.get(),
+          *xT,
+          sacado_param_vec,
+          p_vec.get(),
+          NULL,
+          NULL,
+          NULL,
+          NULL,
+          fT_out.get(),
+          NULL,
+          dfdp_allT.get());
 
       f_already_computed = true;
+
+      // Scatter the column blocks back to each df/dp
+      std::size_t offset = 0;
+      for (int i = 0; i < dfdp_indices.size(); ++i) {
+        const std::size_t num_cols = sacado_param_vec[dfdp_indices[i]].size();
+        TEUCHOS_TEST_FOR_EXCEPTION(
+            dfdp_outTs[i]->getNumVectors() != num_cols,
+            std::logic_error,
+            "Error! DfDp(" << dfdp_indices[i] << ") has "
+                << dfdp_outTs[i]->getNumVectors() << " columns but "
+                << num_cols << " parameters." << std::endl);
+        if (num_cols == 0) continue;
+        const Teuchos::RCP<const Tpetra_MultiVector> dfdp_blockT =
+            dfdp_allT->subView(
+                Teuchos::Range1D(offset, offset + num_cols - 1));
+        dfdp_outTs[i]->update(1.0, *dfdp_blockT, 0.0);
+        offset += num_cols;
+      }
     }
   }
 
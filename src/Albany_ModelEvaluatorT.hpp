@@ -14,6 +14,7 @@
 #include "Albany_Application.hpp"
 
 #include "Teuchos_TimeMonitor.hpp"
+#include "Thyra_PreconditionerFactoryBase.hpp"
 
 namespace Albany {
 
@@ -85,6 +86,21 @@ class ModelEvaluatorT
 
   //@}
 
+  //! Preconditioner factory used with the AD matrix-free Jacobian
+  void
+  setPreconditionerFactory(
+      const Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>>& prec_factory)
+  {
+    prec_factory_ = prec_factory;
+  }
+
+  //! Whether W is the exact matrix-free Jacobian from the Tangent fill
+  bool
+  usesADMatrixFreeJacobian() const
+  {
+    return use_ad_matrix_free_;
+  }
+
 #if defined(ALBANY_LCM)
   // This is here to have a sane way to handle time and avoid Thyra ME.
   ST
@@ -190,6 +206,32 @@ class ModelEvaluatorT
   //! Model uses time integration (accelerations)
   bool supports_xdotdot;
 
+  //! @name AD matrix-free Jacobian with a lagged preconditioner
+  //@{
+  bool use_ad_matrix_free_{false};
+
+  //! Number of W evaluations between preconditioner rebuilds
+  int prec_lag_{1};
+
+  bool rebuild_prec_on_new_time_{true};
+
+  Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>> prec_factory_;
+
+  mutable bool prec_built_{false};
+
+  mutable int prec_age_{0};
+
+  mutable ST prec_time_{0.0};
+
+  //! Rebuild when a solve takes more than this times the Krylov iterations
+  //! of the first solve with the current preconditioner (0: never)
+  double prec_iter_ratio_{0.0};
+
+  mutable int prec_base_iters_{0};
+
+  mutable bool prec_degraded_{false};
+  //@}
+
 #if defined(ALBANY_LCM)
   // This is here to have a sane way to handle time and avoid Thyra ME.
   ST
@@ -82,8 +82,11 @@ void ObserverImpl::observeSolutionT(
   const Teuchos::Ptr<const Tpetra_Vector>& nonOverlappedSolutionDotT,
   const Teuchos::Ptr<const Tpetra_Vector>& nonOverlappedSolutionDotDotT)
 {
-  app_->evaluateStateFieldManagerT(stamp, nonOverlappedSolutionDotT,
-                                   nonOverlappedSolutionDotDotT, nonOverlappedSolutionT);
+  // The states may already have been saved by the last residual evaluation
+  if (!app_->useCapturedStatesT(stamp, nonOverlappedSolutionDotT,
+                                nonOverlappedSolutionDotDotT, nonOverlappedSolutionT))
+    app_->evaluateStateFieldManagerT(stamp, nonOverlappedSolutionDotT,
+                                     nonOverlappedSolutionDotDotT, nonOverlappedSolutionT);
   app_->getStateMgr().updateStates();
 
   StatelessObserverImpl::observeSolutionT(stamp, nonOverlappedSolutionT,
@@ -93,7 +96,15 @@ void ObserverImpl::observeSolutionT(
 void ObserverImpl::observeSolutionT(
   double stamp, const Tpetra_MultiVector &nonOverlappedSolutionT)
 {
-  app_->evaluateStateFieldManagerT(stamp, nonOverlappedSolutionT);
+  const int num_vecs = nonOverlappedSolutionT.getNumVectors();
+  Teuchos::RCP<const Tpetra_Vector> xdotT, xdotdotT;
+  if (num_vecs > 1) xdotT = nonOverlappedSolutionT.getVector(1);
+  if (num_vecs > 2) xdotdotT = nonOverlappedSolutionT.getVector(2);
+
+  // The states may already have been saved by the last residual evaluation
+  if (!app_->useCapturedStatesT(stamp, xdotT.ptr(), xdotdotT.ptr(),
+                                *nonOverlappedSolutionT.getVector(0)))
+    app_->evaluateStateFieldManagerT(stamp, nonOverlappedSolutionT);
   app_->getStateMgr().updateStates();
 
   StatelessObserverImpl::observeSolutionT(stamp, nonOverlappedSolutionT);
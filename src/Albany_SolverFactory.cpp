@@ -29,6 +29,7 @@
 #ifdef ALBANY_IFPACK2
 #include "Teuchos_AbstractFactoryStd.hpp"
 #include "Thyra_Ifpack2PreconditionerFactory.hpp"
+#include "Albany_MixedPrecisionPreconditionerFactory.hpp"
 #endif /* ALBANY_IFPACK2 */
 
 #ifdef ALBANY_MUELU
@@ -586,6 +587,13 @@ enableIfpack2(Stratimikos::DefaultLinearSolverBuilder& linearSolverBuilder)
   typedef Thyra::Ifpack2PreconditionerFactory<Tpetra_CrsMatrix> Impl;
   linearSolverBuilder.setPreconditioningStrategyFactory(
       Teuchos::abstractFactoryStd<Base, Impl>(), "Ifpack2");
+#ifdef HAVE_TPETRA_INST_FLOAT
+  // Ifpack2 set up and applied in float from a copy of the Jacobian.
+  typedef Albany::MixedPrecisionPreconditionerFactory MixedImpl;
+  linearSolverBuilder.setPreconditioningStrategyFactory(
+      Teuchos::abstractFactoryStd<Base, MixedImpl>(),
+      "Mixed Precision Ifpack2");
+#endif
 #endif
 }
 
@@ -601,6 +609,20 @@ enableMueLu(
 }
 }  // namespace
 
+void
+Albany::SolverFactory::setupLinearSolverBuilder(
+    Stratimikos::DefaultLinearSolverBuilder&    linearSolverBuilder,
+    const Teuchos::RCP<Teuchos::ParameterList>& stratList)
+{
+  Teuchos::RCP<Albany::Application> albanyApp;
+  enableIfpack2(linearSolverBuilder);
+  enableMueLu(albanyApp, stratList, linearSolverBuilder);
+#ifdef ALBANY_TEKO
+  Teko::addTekoToStratimikosBuilder(linearSolverBuilder, "Teko");
+#endif
+  linearSolverBuilder.setParameterList(stratList);
+}
+
 Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST>>
 Albany::SolverFactory::createAndGetAlbanyAppT(
     Teuchos::RCP<Albany::Application>&       albanyApp,
@@ -846,13 +868,7 @@ Albany::SolverFactory::createAndGetAlbanyAppT(
     Piro::SolverFactory piroFactory;
     // Setup linear solver
     Stratimikos::DefaultLinearSolverBuilder linearSolverBuilder;
-    enableIfpack2(linearSolverBuilder);
-    enableMueLu(albanyApp, stratList, linearSolverBuilder);
-
-#if defined(ALBANY_TEKO)
-    Teko::addTekoToStratimikosBuilder(linearSolverBuilder, "Teko");
-#endif
-    linearSolverBuilder.setParameterList(stratList);
+    setupLinearSolverBuilder(linearSolverBuilder, stratList);
 
     const RCP<Thyra::LinearOpWithSolveFactoryBase<ST>> lowsFactory =
         createLinearSolveStrategy(linearSolverBuilder);
@@ -907,16 +923,21 @@ Albany::SolverFactory::createAndGetAlbanyAppT(
   } else {
     // Setup linear solver
     Stratimikos::DefaultLinearSolverBuilder linearSolverBuilder;
-    enableIfpack2(linearSolverBuilder);
-    enableMueLu(albanyApp, stratList, linearSolverBuilder);
-#ifdef ALBANY_TEKO
-    Teko::addTekoToStratimikosBuilder(linearSolverBuilder, "Teko");
-#endif
-    linearSolverBuilder.setParameterList(stratList);
+    setupLinearSolverBuilder(linearSolverBuilder, stratList);
 
     const RCP<Thyra::LinearOpWithSolveFactoryBase<ST>> lowsFactory =
         createLinearSolveStrategy(linearSolverBuilder);
 
+    // The matrix-free Jacobian cannot be factored, so the model builds the
+    // lagged preconditioner itself with the Stratimikos one.
+    const RCP<Albany::ModelEvaluatorT> albanyModelT =
+        Teuchos::rcp_dynamic_cast<Albany::ModelEvaluatorT>(modelT_);
+    if (Teuchos::nonnull(albanyModelT) &&
+        albanyModelT->usesADMatrixFreeJacobian() == true) {
+      albanyModelT->setPreconditionerFactory(
+          lowsFactory->getPreconditionerFactory());
+    }
+
     modelWithSolveT = rcp(new Thyra::DefaultModelEvaluatorWithSolveFactory<ST>(
         modelT_, lowsFactory));
   }
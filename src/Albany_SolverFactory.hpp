@@ -31,6 +31,10 @@
 #include "AAdapt_AdaptiveModelFactory.hpp"
 #endif
 
+namespace Stratimikos {
+class DefaultLinearSolverBuilder;
+}
+
 //! Albany driver code, problems, discretizations, and responses
 namespace Albany {
 
@@ -137,6 +141,14 @@ class SolverFactory {
     is_schwarz_ = schwarz;
   }
 
+  //! Register the preconditioner factories Albany adds to Stratimikos
+  //! (Ifpack2, MueLu, Teko) and set the Stratimikos parameters. Solvers
+  //! built outside of the factory use this so they accept the same inputs.
+  static void
+  setupLinearSolverBuilder(
+      Stratimikos::DefaultLinearSolverBuilder&    linearSolverBuilder,
+      const Teuchos::RCP<Teuchos::ParameterList>& stratList);
+
  public:
   // Functions to generate reference parameter lists for validation
   //  EGN 9/2013: made these three functions public, as they pertain to valid
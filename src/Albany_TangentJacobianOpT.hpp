@@ -0,0 +1,175 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_TANGENT_JACOBIAN_OP_T_HPP
+#define ALBANY_TANGENT_JACOBIAN_OP_T_HPP
+
+#include "Albany_DataTypes.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_TestForException.hpp"
+
+#include "Albany_Application.hpp"
+
+namespace Albany {
+
+  //! Tpetra_Operator implementing the exact action of the Jacobian
+  /*!
+   * This class implements the Tpetra_Operator interface for
+   * W*v = (alpha*df/dxdot + beta*df/dx + omega*df/dxdotdot)*v, where f is
+   * the Albany residual vector and v is a given vector. Each apply() is one
+   * Tangent fill seeded with v, so the Jacobian is never assembled.
+   */
+  class TangentJacobianOpT : public Tpetra_Operator {
+  public:
+
+    // Constructor
+    TangentJacobianOpT(const Teuchos::RCP<Application>& app_) :
+      app(app_),
+      alpha(0.0),
+      beta(1.0),
+      omega(0.0),
+      time(0.0),
+      num_applies(0) {}
+
+    //! Destructor
+    virtual ~TangentJacobianOpT() {}
+
+    //! Set values needed for apply()
+    void set(const double alpha_,
+             const double beta_,
+             const double omega_,
+             const double time_,
+             const Teuchos::RCP<const Tpetra_Vector>& xdot_,
+             const Teuchos::RCP<const Tpetra_Vector>& xdotdot_,
+             const Teuchos::RCP<const Tpetra_Vector>& x_,
+             const Teuchos::RCP<Teuchos::Array<ParamVec> >& scalar_params_) {
+      alpha = alpha_;
+      beta = beta_;
+      omega = omega_;
+      time = time_;
+      // Copy the state, the caller may reuse its vectors before the
+      // Krylov solve is done with this operator.
+      xdot = Teuchos::null;
+      if (xdot_ != Teuchos::null)
+        xdot = Teuchos::rcp(new Tpetra_Vector(*xdot_, Teuchos::Copy));
+      xdotdot = Teuchos::null;
+      if (xdotdot_ != Teuchos::null)
+        xdotdot = Teuchos::rcp(new Tpetra_Vector(*xdotdot_, Teuchos::Copy));
+      x = Teuchos::rcp(new Tpetra_Vector(*x_, Teuchos::Copy));
+      scalar_params = scalar_params_;
+      num_applies = 0;
+    }
+
+    //! Number of apply() calls since the last set(), i.e., the number of
+    //! Krylov iterations of the last linear solve with this operator
+    int getNumApplies() const {
+      return num_applies;
+    }
+
+    //! @name Tpetra_Operator methods
+    //@{
+
+    /*!
+     * \brief Returns the result of a Tpetra_Operator applied to a
+     * Tpetra_MultiVector X in Y.
+     */
+    virtual void apply(const Tpetra_MultiVector& X,
+                      Tpetra_MultiVector& Y,  Teuchos::ETransp  mode = Teuchos::NO_TRANS,
+                      ST a = Teuchos::ScalarTraits<ST>::one(),
+                      ST b = Teuchos::ScalarTraits<ST>::zero() ) const {
+      TEUCHOS_TEST_FOR_EXCEPTION(
+        mode != Teuchos::NO_TRANS, std::logic_error,
+        "TangentJacobianOpT does not support transpose apply.\n");
+
+      TEUCHOS_TEST_FOR_EXCEPTION(
+        x == Teuchos::null, std::logic_error,
+        "TangentJacobianOpT::apply() called before set().\n");
+
+      Tpetra_MultiVector
+      JV(Y.getMap(), X.getNumVectors());
+
+      // The Tangent fill seeds x with beta*Vx, xdot with alpha*Vxdot and
+      // xdotdot with omega*Vxdotdot, so the same direction goes in all three.
+      app->computeGlobalTangentT(alpha, beta, omega, time, false,
+                                 xdot.get(), xdotdot.get(), *x,
+                                 *scalar_params, NULL,
+                                 &X,
+                                 xdot == Teuchos::null ? NULL : &X,
+                                 xdotdot == Teuchos::null ? NULL : &X,
+                                 NULL, NULL, &JV, NULL);
+
+      Y.update(a, JV, b);
+
+      num_applies += X.getNumVectors();
+    }
+
+    //! Returns a character string describing the operator
+    virtual const char * Label() const {
+      return "TangentJacobianOpT";
+    }
+
+    virtual bool hasTransposeApply() const {
+      return false;
+    }
+
+    /*!
+     * \brief Returns the Tpetra_Map object associated with the domain of
+     * this operator.
+     */
+    virtual Teuchos::RCP<const Tpetra_Map> getDomainMap() const {
+      return app->getMapT();
+    }
+
+    /*!
+     * \brief Returns the Tpetra_Map object associated with the range of
+     * this operator.
+     */
+    virtual Teuchos::RCP<const Tpetra_Map> getRangeMap() const {
+      return app->getMapT();
+    }
+
+    //@}
+
+  protected:
+
+    //! Albany applications
+    Teuchos::RCP<Application> app;
+
+    //! @name Data needed for apply()
+    //@{
+
+    //! Coefficients of df/dxdot, df/dx and df/dxdotdot
+    double alpha;
+    double beta;
+    double omega;
+
+    //! Current time
+    double time;
+
+    //! Velocity vector
+    Teuchos::RCP<const Tpetra_Vector> xdot;
+
+    //! Acceleration vector
+    Teuchos::RCP<const Tpetra_Vector> xdotdot;
+
+    //! Solution vector
+    Teuchos::RCP<const Tpetra_Vector> x;
+
+    //! Scalar parameters
+    Teuchos::RCP<Teuchos::Array<ParamVec> > scalar_params;
+
+    //! Number of apply() calls since the last set()
+    mutable int num_applies;
+
+    //@}
+
+  }; // class TangentJacobianOpT
+
+} // namespace Albany
+
+#endif // ALBANY_TANGENT_JACOBIAN_OP_T_HPP
@@ -537,6 +537,12 @@ void Adapter::adapt(const double t_current) {
   auto t_sim_field = apf::getSIMField(t_apf_field);
   auto m_sim_field = apf::getSIMField(m_apf_field);
 
+  // drop the integration point output fields kept between writes
+  auto t_sim_disc = rcp_dynamic_cast<Albany::SimDiscretization>(t_disc);
+  auto m_sim_disc = rcp_dynamic_cast<Albany::SimDiscretization>(m_disc);
+  t_sim_disc->detachQPData();
+  m_sim_disc->detachQPData();
+
   // compute chosen spr error estimate on the chosen field
   auto spr_field_name = params->get<std::string>("SPR Solution Field", "");
   auto spr_size_field = compute_error_size(
@@ -614,12 +620,10 @@ void Adapter::adapt(const double t_current) {
   PCU_Barrier();
   double t7 = PCU_Time();
   *out << "adapt(): mesh verified in " << t7-t5 << " seconds\n";
-  auto t_sim_disc = rcp_dynamic_cast<Albany::SimDiscretization>(t_disc);
   t_sim_disc->updateMesh(/* transfer ip = */ false, param_lib);
   PCU_Barrier();
   double t8 = PCU_Time();
   *out << "adapt(): updated temperature discretization in " << t8-t7 << " seconds\n";
-  auto m_sim_disc = rcp_dynamic_cast<Albany::SimDiscretization>(m_disc);
   m_sim_disc->updateMesh(/* transfer ip = */ false, param_lib);
   PCU_Barrier();
   double t9 = PCU_Time();
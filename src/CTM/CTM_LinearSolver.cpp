@@ -47,24 +47,6 @@ static RCP<ParameterList> get_belos_params(RCP<const ParameterList> in) {
   return p;
 }
 
-static RCP<Solver> build_muelu_solver(
-    RCP<const ParameterList> in,
-    RCP<Tpetra_CrsMatrix> A,
-    RCP<Tpetra_Vector> x,
-    RCP<Tpetra_Vector> b,
-    RCP<Tpetra_MultiVector> coords,
-    RCP<Tpetra_MultiVector> nullspace) {
-  auto muelu_params = in->sublist("Preconditioner");
-  auto belos_params = get_belos_params(in);
-  auto AA = (RCP<OP>)A;
-  auto M = MueLu::CreateTpetraPreconditioner(AA, muelu_params, coords, nullspace);
-  auto problem = rcp(new LinearProblem(A, x, b));
-  problem->setLeftPrec(M);
-  problem->setProblem();
-  auto solver = rcp(new GmresSolver(problem, belos_params));
-  return solver;
-}
-
 static void get_inv_row_sum(RCP<Tpetra_CrsMatrix> A, RCP<Tpetra_Vector> s) {
   s->putScalar(0.0);
   auto view = s->get1dViewNonConst();
@@ -249,36 +231,113 @@ void solve_linear_system(
     RCP<Tpetra_Vector> x,
     RCP<Tpetra_Vector> b,
     RCP<Albany::AbstractDiscretization> d) {
+  LinearSolver solver(in, d);
+  solver.solve(A, x, b);
+}
+
+LinearSolver::LinearSolver(
+    RCP<const ParameterList> in,
+    RCP<Albany::AbstractDiscretization> d) {
+  params = in;
+  disc = d;
+  out = Teuchos::VerboseObjectBase::getDefaultOStream();
+  muelu_params = rcp(new ParameterList(in->sublist("Preconditioner")));
+  belos_params = get_belos_params(in);
+  reuse_type = NONE;
+  if (in->isType<std::string>("Preconditioner Reuse")) {
+    auto type = in->get<std::string>("Preconditioner Reuse");
+    if (type == "Symbolic") reuse_type = SYMBOLIC;
+    else if (type == "Full") reuse_type = FULL;
+    else TEUCHOS_TEST_FOR_EXCEPTION(type != "None", std::logic_error,
+        "unknown preconditioner reuse type: " << type);
+  }
+  rebuild_factor = 2.0;
+  if (in->isType<double>("Preconditioner Rebuild Factor"))
+    rebuild_factor = in->get<double>("Preconditioner Rebuild Factor");
+  // keep the aggregates and transfer operators between numeric setups
+  if (reuse_type == SYMBOLIC && ! muelu_params->isParameter("reuse: type"))
+    muelu_params->set("reuse: type", "RP");
+  reset();
+}
+
+void LinearSolver::reset() {
+  coords = Teuchos::null;
+  prec = Teuchos::null;
+  prec_matrix = Teuchos::null;
+  problem = Teuchos::null;
+  solver = Teuchos::null;
+  base_iters = 0;
+  needs_rebuild = true;
+}
+
+void LinearSolver::build_preconditioner(RCP<Tpetra_CrsMatrix> A) {
+
+  // a new matrix object means the maps may have changed
+  bool same_matrix = (prec != Teuchos::null) && (A == prec_matrix);
+
+  if (needs_rebuild || ! same_matrix || reuse_type == NONE) {
+    *out << "  linear solver: building MueLu hierarchy" << std::endl;
+    if ((disc != Teuchos::null) && (coords == Teuchos::null || ! same_matrix))
+      coords = get_coords(disc, out);
+    RCP<Tpetra_MultiVector> nullspace;
+    auto AA = (RCP<OP>)A;
+    prec = MueLu::CreateTpetraPreconditioner(AA, *muelu_params, coords, nullspace);
+    prec_matrix = A;
+    base_iters = 0;
+    needs_rebuild = false;
+  } else if (reuse_type == SYMBOLIC) {
+    *out << "  linear solver: reusing MueLu symbolic setup" << std::endl;
+    auto M = rcp_dynamic_cast<MueLu::TpetraOperator<ST, LO, Tpetra_GO, KokkosNode> >(prec);
+    auto AA = (RCP<OP>)A;
+    MueLu::ReuseTpetraPreconditioner(AA, *M);
+  } else {
+    *out << "  linear solver: reusing MueLu hierarchy" << std::endl;
+  }
+}
+
+void LinearSolver::solve(
+    RCP<Tpetra_CrsMatrix> A,
+    RCP<Tpetra_Vector> x,
+    RCP<Tpetra_Vector> b) {
 
   // useful timing info
-  RCP<Teuchos::FancyOStream> out(Teuchos::VerboseObjectBase::getDefaultOStream());
   double t0 = PCU_Time();
   *out << "  linear system # equations: " <<  x->getGlobalLength() << std::endl;
 
   // scale the linear system if specified
   // not sure this actually helps at all ?
-  scale_system(in, A, b, out);
+  scale_system(params, A, b, out);
 
-  // get the coordinates and the null space if specified
-  RCP<Tpetra_MultiVector> coords;
-  RCP<Tpetra_MultiVector> nullspace;
-  if (d != Teuchos::null) {
-    coords = get_coords(d, out);
-  }
+  // build or reuse the preconditioner
+  build_preconditioner(A);
 
-  // build the solver and solve
-  RCP<Solver> solver = build_muelu_solver(in, A, x, b, coords, nullspace);
+  // update the persistent solver and solve
+  if (problem == Teuchos::null) {
+    problem = rcp(new LinearProblem(A, x, b));
+    solver = rcp(new GmresSolver(problem, belos_params));
+  }
+  problem->setOperator(A);
+  problem->setLeftPrec(prec);
+  problem->setProblem(x, b);
+  solver->setProblem(problem);
   solver->solve();
 
   // print some final information
   int iters = solver->getNumIters();
   double t1 = PCU_Time();
-  if (iters >= in->get<int>("Linear Max Iterations")) {
+  if (iters >= params->get<int>("Linear Max Iterations")) {
     *out << "  linear solve failed to converge in " << iters << " iterations" << std::endl;
     *out << "  continuing using the incomplete solve..." << std::endl;
+    needs_rebuild = true;
   } else {
     *out << "  linear system solved in " << t1 - t0 << " seconds" << std::endl;
   }
+
+  // rebuild at the next solve if the reused hierarchy has degraded
+  if (base_iters == 0)
+    base_iters = std::max(iters, 1);
+  else if (iters > rebuild_factor * base_iters)
+    needs_rebuild = true;
 }
 
 } // namespace CTM
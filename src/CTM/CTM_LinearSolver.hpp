@@ -7,6 +7,15 @@ namespace Albany {
 class AbstractDiscretization;
 } // namespace Albany
 
+namespace Teuchos {
+class FancyOStream;
+} // namespace Teuchos
+
+namespace Belos {
+template <class ScalarType, class MV, class OP> class LinearProblem;
+template <class ScalarType, class MV, class OP> class SolverManager;
+} // namespace Belos
+
 namespace CTM {
 
 using Teuchos::RCP;
@@ -19,6 +28,55 @@ void solve_linear_system(
     RCP<Tpetra_Vector> b,
     RCP<Albany::AbstractDiscretization> d = Teuchos::null);
 
+/** \brief A linear solver that persists across time steps.
+  *
+  * The MueLu hierarchy is kept between solves. Depending on the
+  * "Preconditioner Reuse" parameter it is rebuilt at every solve ("None"),
+  * recomputed numerically on the symbolic setup of the last rebuild
+  * ("Symbolic"), or applied as is ("Full"). A full rebuild is triggered
+  * when the iteration count grows past "Preconditioner Rebuild Factor"
+  * times the count of the solve right after the last rebuild. */
+class LinearSolver {
+
+  public:
+
+    LinearSolver(
+        RCP<const ParameterList> p,
+        RCP<Albany::AbstractDiscretization> d = Teuchos::null);
+
+    void solve(
+        RCP<Tpetra_CrsMatrix> A,
+        RCP<Tpetra_Vector> x,
+        RCP<Tpetra_Vector> b);
+
+    /** \brief Drop the hierarchy, e.g. after the mesh has been adapted. */
+    void reset();
+
+  private:
+
+    enum ReuseType { NONE, SYMBOLIC, FULL };
+
+    RCP<const ParameterList> params;
+    RCP<ParameterList> muelu_params;
+    RCP<ParameterList> belos_params;
+    RCP<Albany::AbstractDiscretization> disc;
+    RCP<Teuchos::FancyOStream> out;
+
+    ReuseType reuse_type;
+    double rebuild_factor;
+
+    RCP<Tpetra_MultiVector> coords;
+    RCP<Tpetra_Operator> prec;
+    RCP<Tpetra_CrsMatrix> prec_matrix;
+    RCP<Belos::LinearProblem<ST, Tpetra_MultiVector, Tpetra_Operator> > problem;
+    RCP<Belos::SolverManager<ST, Tpetra_MultiVector, Tpetra_Operator> > solver;
+    int base_iters;
+    bool needs_rebuild;
+
+    void build_preconditioner(RCP<Tpetra_CrsMatrix> A);
+
+};
+
 } // namespace CTM
 
 #endif
@@ -143,6 +143,12 @@ void Solver::initial_setup() {
   auto apf_disc = rcp_dynamic_cast<Albany::APFDiscretization>(m_disc);
   apf_disc->writeAnySolutionToFile(0);
 
+  // build the linear solvers, which persist across time steps
+  t_linear_solver = rcp(new LinearSolver(
+        rcpFromRef(params->sublist("Temp Linear Algebra"))));
+  m_linear_solver = rcp(new LinearSolver(
+        rcpFromRef(params->sublist("Mech Linear Algebra")), m_disc));
+
   // create the adapter if it is needed
   if (adapt_params != Teuchos::null)
     adapter = rcp(new Adapter(adapt_params, param_lib, t_state_mgr, m_state_mgr));
@@ -153,9 +159,6 @@ void Solver::solve_temp() {
 
   *out << "Solving thermal physics" << std::endl;
 
-  // get linear solve parameters
-  auto la_params = rcpFromRef(params->sublist("Temp Linear Algebra"));
-
   // get the thermal solution info
   auto T = t_sol_info->owned->x;
   auto dTdt = t_sol_info->owned->x_dot;
@@ -178,7 +181,7 @@ void Solver::solve_temp() {
   t_assembler->assemble_system(alpha, beta, omega, t_current, t_old);
   f->scale(-1.0);
   delta_T->putScalar(0.0);
-  solve_linear_system(la_params, J, delta_T, f);
+  t_linear_solver->solve(J, delta_T, f);
 
   // perform updates
   T->update(1.0, *delta_T, 1.0);
@@ -196,9 +199,6 @@ void Solver::solve_mech() {
 
   *out << "Solving mechanics physics" << std::endl;
 
-  // get linear solve parameters
-  auto la_params = rcpFromRef(params->sublist("Mech Linear Algebra"));
-
   // get the mechanics solution
   auto u = m_sol_info->owned->x;
   auto f = m_sol_info->owned->f;
@@ -213,7 +213,7 @@ void Solver::solve_mech() {
   u->putScalar(0.0);
   m_assembler->assemble_system(alpha, beta, omega, t_current, t_old);
   f->scale(-1.0);
-  solve_linear_system(la_params, J, u, f, m_disc);
+  m_linear_solver->solve(J, u, f);
 
   // perform updates
   m_assembler->assemble_state(t_current, t_old);
@@ -228,6 +228,8 @@ void Solver::solve_mech() {
 void Solver::adapt_mesh() {
   *out << "beginning mesh adaptation: " << std::endl;
   adapter->adapt(t_current);
+  t_linear_solver->reset();
+  m_linear_solver->reset();
   t_sol_info->resize(t_disc, true);
   m_sol_info->resize(m_disc, false);
   t_sol_info->owned->x = t_disc->getSolutionFieldT();
@@ -427,6 +427,7 @@ FELIX::StokesFO::getValidProblemParameters () const
   validPL->sublist("Parameter Fields", false, "Parameter Fields to be registered");
   validPL->set<bool>("Use Time Parameter", false, "Solely to use Solver Method = Continuation");
   validPL->set<bool>("Print Stress Tensor", false, "Whether to save stress tensor in the mesh");
+  validPL->set<int>("Geometry Cache Size", 0, "Number of worksets whose basis function and side geometry is cached while the coordinates do not change (0: disabled, -1: all worksets)");
 
   return validPL;
 }
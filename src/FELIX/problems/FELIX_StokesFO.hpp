@@ -180,6 +180,7 @@ FELIX::StokesFO::constructEvaluators (PHX::FieldManager<PHAL::AlbanyTraits>& fm0
   int offset=0;
   bool isObsVelRMSScalar=false;
   const bool enableMemoizer = this->params->get<bool>("Use MDField Memoization", false);
+  const int geometryCacheSize = this->params->get<int>("Geometry Cache Size", 0);
 
   Albany::StateStruct::MeshFieldEntity entity;
   Teuchos::RCP<PHX::Evaluator<PHAL::AlbanyTraits> > ev;
@@ -924,7 +925,7 @@ if (basalSideName!="INVALID")
   fm0.template registerEvaluator<EvalT> (ev);
 
   // Compute basis funcitons
-  ev = evalUtils.constructComputeBasisFunctionsEvaluator(cellType, cellBasis, cellCubature, enableMemoizer);
+  ev = evalUtils.constructComputeBasisFunctionsEvaluator(cellType, cellBasis, cellCubature, enableMemoizer, geometryCacheSize);
   fm0.template registerEvaluator<EvalT> (ev);
 
   // Intepolate surface height
@@ -949,7 +950,7 @@ if (basalSideName!="INVALID")
     fm0.template registerEvaluator<EvalT> (ev);
 
     //---- Compute side basis functions
-    ev = evalUtils.constructComputeBasisFunctionsSideEvaluator(cellType, basalSideBasis, basalCubature, basalSideName, enableMemoizer);
+    ev = evalUtils.constructComputeBasisFunctionsSideEvaluator(cellType, basalSideBasis, basalCubature, basalSideName, enableMemoizer, false, geometryCacheSize);
     fm0.template registerEvaluator<EvalT> (ev);
 
     //---- Restrict velocity from cell-based to cell-side-based
@@ -1078,7 +1079,7 @@ if (basalSideName!="INVALID")
     fm0.template registerEvaluator<EvalT> (ev);
 
     //---- Compute side basis functions
-    ev = evalUtils.constructComputeBasisFunctionsSideEvaluator(cellType, surfaceSideBasis, surfaceCubature, surfaceSideName);
+    ev = evalUtils.constructComputeBasisFunctionsSideEvaluator(cellType, surfaceSideBasis, surfaceCubature, surfaceSideName, false, false, geometryCacheSize);
     fm0.template registerEvaluator<EvalT> (ev);
 
     //---- Interpolate surface velocity on QP on side
@@ -1115,7 +1116,7 @@ if (basalSideName!="INVALID")
     fm0.template registerEvaluator<EvalT> (ev);
 
     //---- Compute side basis functions
-    ev = evalUtils.constructComputeBasisFunctionsSideEvaluator(cellType, lateralSideBasis, lateralCubature, lateralSideName, false, true);
+    ev = evalUtils.constructComputeBasisFunctionsSideEvaluator(cellType, lateralSideBasis, lateralCubature, lateralSideName, false, true, geometryCacheSize);
     fm0.template registerEvaluator<EvalT> (ev);
 
     //---- Interpolate ice thickness on QP on side
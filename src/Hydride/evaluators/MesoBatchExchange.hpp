@@ -0,0 +1,96 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef MESOBATCHEXCHANGE_HPP
+#define MESOBATCHEXCHANGE_HPP
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace LCM {
+
+/** \brief Batched, non-blocking exchange of point data with the meso PEs
+
+    numPts points of pointSize doubles each are sent to the numMesoPEs remote
+    ranks of interCommunicator in messages of up to batchSize points. Each
+    message holds a two-double header (number of points, number of states per
+    point) followed by the point data; the meso PE answers with the same layout.
+    Batches are handed out to whichever meso PE returns first, and the answers
+    are written to statesOut in the order of statesIn.
+
+*/
+inline void
+exchangeMesoBatches(const std::vector<double>& statesIn,
+                    std::vector<double>& statesOut,
+                    int numPts,
+                    int numStates,
+                    int pointSize,
+                    int batchSize,
+                    int numMesoPEs,
+                    int tag,
+                    MPI_Comm interCommunicator) {
+
+  int numBatches = (numPts + batchSize - 1) / batchSize;
+
+  std::vector<std::vector<double> > sendBufs(numMesoPEs), rcvBufs(numMesoPEs);
+  std::vector<MPI_Request> sendReqs(numMesoPEs, MPI_REQUEST_NULL);
+  std::vector<MPI_Request> rcvReqs(numMesoPEs, MPI_REQUEST_NULL);
+  std::vector<int> batchOnProc(numMesoPEs, -1);
+
+  int nextBatch = 0;
+  int numActive = 0;
+
+  // Post the next batch to a free meso PE
+  auto post = [&](int proc) {
+    int first = nextBatch * batchSize;
+    int n = std::min(batchSize, numPts - first);
+    std::size_t len = 2 + n * pointSize;
+
+    sendBufs[proc].resize(len);
+    rcvBufs[proc].resize(len);
+    sendBufs[proc][0] = n;
+    sendBufs[proc][1] = numStates;
+    std::copy(statesIn.begin() + first * pointSize,
+              statesIn.begin() + (first + n) * pointSize,
+              sendBufs[proc].begin() + 2);
+
+    MPI_Irecv(&rcvBufs[proc][0], len, MPI_DOUBLE, proc, tag,
+              interCommunicator, &rcvReqs[proc]);
+    MPI_Isend(&sendBufs[proc][0], len, MPI_DOUBLE, proc, tag,
+              interCommunicator, &sendReqs[proc]);
+
+    batchOnProc[proc] = nextBatch++;
+    numActive++;
+  };
+
+  for(int proc = 0; proc < numMesoPEs && nextBatch < numBatches; proc++)
+    post(proc);
+
+  while(numActive > 0) {
+
+    int proc;
+    MPI_Waitany(numMesoPEs, &rcvReqs[0], &proc, MPI_STATUS_IGNORE);
+    MPI_Wait(&sendReqs[proc], MPI_STATUS_IGNORE);
+    numActive--;
+
+    // Unpack the returned batch
+    int first = batchOnProc[proc] * batchSize;
+    int n = std::min(batchSize, numPts - first);
+    std::copy(rcvBufs[proc].begin() + 2, rcvBufs[proc].begin() + 2 + n * pointSize,
+              statesOut.begin() + first * pointSize);
+
+    if(nextBatch < numBatches)
+      post(proc);
+
+  }
+
+}
+
+}
+
+#endif
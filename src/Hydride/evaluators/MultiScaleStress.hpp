@@ -20,7 +20,7 @@ namespace LCM {
 */
 
 //! MPI message tags
-enum MessageType {STRESS_TENSOR, STRAIN_TENSOR, TANGENT, DIE};
+enum MessageType {STRESS_TENSOR, STRAIN_TENSOR, TANGENT, DIE, STRESS_BATCH};
 
 
 template<typename EvalT, typename Traits>
@@ -45,6 +45,16 @@ class MultiScaleStressBase : public PHX::EvaluatorWithBaseImpl<Traits>,
                                   PHX::MDField<RealType, Cell, QuadPoint, Dim, Dim>& stressFieldIn,
                                   typename Traits::EvalData workset);
 
+    // Protected function for the finite difference stress and tangent, for the Fad types
+    void mesoBridgeStressFD(typename Traits::EvalData workset);
+
+    // Exchange numStates stress tensors per cell and qp with MPALE in batched,
+    // non-blocking messages, handing out batches to whichever meso PE is free
+    void mesoBridgeStressBatched(const std::vector<double>& statesIn,
+                                 std::vector<double>& statesOut,
+                                 int numStates,
+                                 typename Traits::EvalData workset);
+
     PHX::MDField<RealType, Cell, QuadPoint, Dim, Dim> stressFieldRealType;
 
 
@@ -67,6 +77,7 @@ class MultiScaleStressBase : public PHX::EvaluatorWithBaseImpl<Traits>,
     unsigned int numDims;
 
     int numMesoPEs;
+    int mesoBatchSize;
     std::vector<double> exchanged_stresses;
     std::vector<MesoPt> loc_data;
     Teuchos::RCP<MPI_Comm> interCommunicator;
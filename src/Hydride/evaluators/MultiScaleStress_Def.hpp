@@ -9,6 +9,8 @@
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
 
+#include "MesoBatchExchange.hpp"
+
 namespace LCM {
 
 //**********************************************************************
@@ -42,6 +44,7 @@ MultiScaleStressBase(const Teuchos::ParameterList& p) :
 
   numMesoPEs = p.get<int>("Num Meso PEs");
   interCommunicator = p.get< Teuchos::RCP<MPI_Comm> >("MPALE Intercommunicator");
+  mesoBatchSize = p.isParameter("Meso Batch Size") ? p.get<int>("Meso Batch Size") : 0;
 
   loc_data.resize(numMesoPEs);
   exchanged_stresses.resize(numDims * numDims);
@@ -192,17 +195,77 @@ evaluateFields(typename Traits::EvalData workset) {
 
   this->calcStress(workset);
 
-  this->mesoBridgeStressRealType(this->stress, this->stress, workset);
+  if(this->mesoBatchSize > 0) {
+    int tensorSize = this->numDims * this->numDims;
+    std::vector<double> statesIn(workset.numCells * this->numQPs * tensorSize);
+    std::vector<double> statesOut(statesIn.size());
+
+    for(int cell = 0; cell < (int)workset.numCells; ++cell)
+      for(int qp = 0; qp < (int)this->numQPs; ++qp)
+        for(int i = 0; i < (int)this->numDims; ++i)
+          for(int j = 0; j < (int)this->numDims; ++j)
+            statesIn[(cell * this->numQPs + qp) * tensorSize + this->numDims * i + j] = this->stress(cell, qp, i, j);
+
+    this->mesoBridgeStressBatched(statesIn, statesOut, 1, workset);
+
+    for(int cell = 0; cell < (int)workset.numCells; ++cell)
+      for(int qp = 0; qp < (int)this->numQPs; ++qp)
+        for(int i = 0; i < (int)this->numDims; ++i)
+          for(int j = 0; j < (int)this->numDims; ++j)
+            this->stress(cell, qp, i, j) = statesOut[(cell * this->numQPs + qp) * tensorSize + this->numDims * i + j];
+  }
+  else
+    this->mesoBridgeStressRealType(this->stress, this->stress, workset);
 
   return;
 
 }
 
-template<typename Traits>
-void MultiScaleStress<PHAL::AlbanyTraits::Jacobian, Traits>::
-evaluateFields(typename Traits::EvalData workset) {
+template<typename EvalT, typename Traits>
+void MultiScaleStressBase<EvalT, Traits>::
+mesoBridgeStressFD(typename Traits::EvalData workset) {
 
-  this->calcStress(workset);
+  double pert = 1.0e-6;
+  int numIVs = this->stress(0, 0, 0, 0).size();
+
+  if(mesoBatchSize > 0) {
+
+    // Ship the unperturbed and all perturbed states of a point in the same message
+
+    int numStates = numIVs + 1;
+    int tensorSize = numDims * numDims;
+    std::vector<double> statesIn(workset.numCells * numQPs * numStates * tensorSize);
+    std::vector<double> statesOut(statesIn.size());
+
+    for(int cell = 0; cell < (int)workset.numCells; ++cell)
+      for(int qp = 0; qp < (int)numQPs; ++qp) {
+        double* pt = &statesIn[(cell * numQPs + qp) * numStates * tensorSize];
+        for(int i = 0; i < (int)numDims; ++i)
+          for(int j = 0; j < (int)numDims; ++j) {
+            pt[numDims * i + j] = this->stress(cell, qp, i, j).val();
+            for(int iv = 0; iv < numIVs; ++iv)
+              pt[(iv + 1) * tensorSize + numDims * i + j] =
+                this->stress(cell, qp, i, j).val() + pert * this->stress(cell, qp, i, j).fastAccessDx(iv);
+          }
+      }
+
+    mesoBridgeStressBatched(statesIn, statesOut, numStates, workset);
+
+    for(int cell = 0; cell < (int)workset.numCells; ++cell)
+      for(int qp = 0; qp < (int)numQPs; ++qp) {
+        const double* pt = &statesOut[(cell * numQPs + qp) * numStates * tensorSize];
+        for(int i = 0; i < (int)numDims; ++i)
+          for(int j = 0; j < (int)numDims; ++j) {
+            this->stress(cell, qp, i, j).val() = pt[numDims * i + j];
+            for(int iv = 0; iv < numIVs; ++iv)
+              this->stress(cell, qp, i, j).fastAccessDx(iv) =
+                (pt[(iv + 1) * tensorSize + numDims * i + j] - pt[numDims * i + j]) / pert;
+          }
+      }
+
+    return;
+
+  }
 
   // Begin Finite Difference
   // Do Base unperturbed case
@@ -223,8 +286,6 @@ evaluateFields(typename Traits::EvalData workset) {
           this->stress(cell, qp, i, j).val() = this->stressFieldRealType(cell, qp, i, j);
 
   // Do Perturbations
-  double pert = 1.0e-6;
-  int numIVs = this->stress(0, 0, 0, 0).size();
 
   for(int iv = 0; iv < numIVs; ++iv) {
     for(int cell = 0; cell < (int)workset.numCells; ++cell)
@@ -252,56 +313,41 @@ evaluateFields(typename Traits::EvalData workset) {
 
 }
 
-// Tangent implementation is Identical to Jacobian
-template<typename Traits>
-void MultiScaleStress<PHAL::AlbanyTraits::Tangent, Traits>::
-evaluateFields(typename Traits::EvalData workset) {
-
-  this->calcStress(workset);
-
-  // Begin Finite Difference
-  // Do Base unperturbed case
-  for(int cell = 0; cell < (int)workset.numCells; ++cell)
-    for(int qp = 0; qp < (int)this->numQPs; ++qp)
-      for(int i = 0; i < (int)this->numDims; ++i)
-        for(int j = 0; j < (int)this->numDims; ++j)
-
-          this->stressFieldRealType(cell, qp, i, j) = this->stress(cell, qp, i, j).val();
+template<typename EvalT, typename Traits>
+void MultiScaleStressBase<EvalT, Traits>::
+mesoBridgeStressBatched(const std::vector<double>& statesIn,
+                        std::vector<double>& statesOut,
+                        int numStates,
+                        typename Traits::EvalData workset) {
 
-  this->mesoBridgeStressRealType(this->stressFieldRealType, this->stressFieldRealType, workset);
+  exchangeMesoBatches(statesIn, statesOut, workset.numCells * numQPs, numStates,
+                      numStates * numDims * numDims, mesoBatchSize, numMesoPEs,
+                      STRESS_BATCH, *interCommunicator.get());
 
-  for(int cell = 0; cell < (int)workset.numCells; ++cell)
-    for(int qp = 0; qp < (int)this->numQPs; ++qp)
-      for(int i = 0; i < (int)this->numDims; ++i)
-        for(int j = 0; j < (int)this->numDims; ++j)
+  return;
 
-          this->stress(cell, qp, i, j).val() = this->stressFieldRealType(cell, qp, i, j);
+}
 
-  // Do Perturbations
-  double pert = 1.0e-6;
-  int numIVs = this->stress(0, 0, 0, 0).size();
+template<typename Traits>
+void MultiScaleStress<PHAL::AlbanyTraits::Jacobian, Traits>::
+evaluateFields(typename Traits::EvalData workset) {
 
-  for(int iv = 0; iv < numIVs; ++iv) {
-    for(int cell = 0; cell < (int)workset.numCells; ++cell)
-      for(int qp = 0; qp < (int)this->numQPs; ++qp)
-        for(int i = 0; i < (int)this->numDims; ++i)
-          for(int j = 0; j < (int)this->numDims; ++j)
+  this->calcStress(workset);
 
-            this->stressFieldRealType(cell, qp, i, j) =
-              this->stress(cell, qp, i, j).val() + pert * this->stress(cell, qp, i, j).fastAccessDx(iv);
+  this->mesoBridgeStressFD(workset);
 
-    this->mesoBridgeStressRealType(this->stressFieldRealType, this->stressFieldRealType, workset);
+  return;
 
-    for(int cell = 0; cell < (int)workset.numCells; ++cell)
-      for(int qp = 0; qp < (int)this->numQPs; ++qp)
-        for(int i = 0; i < (int)this->numDims; ++i)
-          for(int j = 0; j < (int)this->numDims; ++j)
+}
 
-            this->stress(cell, qp, i, j).fastAccessDx(iv) =
-              (this->stressFieldRealType(cell, qp, i, j) - this->stress(cell, qp, i, j).val()) / pert;
-  }
+// Tangent implementation is Identical to Jacobian
+template<typename Traits>
+void MultiScaleStress<PHAL::AlbanyTraits::Tangent, Traits>::
+evaluateFields(typename Traits::EvalData workset) {
 
+  this->calcStress(workset);
 
+  this->mesoBridgeStressFD(workset);
 
   return;
 
@@ -59,6 +59,9 @@ MesoScaleLinkProblem(const Teuchos::RCP<Teuchos::ParameterList>& params_,
 
   numMesoPEs = params->sublist("Material Model").get("Num Meso PEs", 1);
 
+  // Number of quadrature points per batched message; 0 uses the per-point protocol
+  mesoBatchSize = params->sublist("Material Model").get("Meso Batch Size", 0);
+
   interCommunicator = Teuchos::rcp(new MPI_Comm());
 
   // Fire off the remote processes
@@ -251,6 +254,7 @@ Albany::MesoScaleLinkProblem::getValidProblemParameters() const {
   if(matModel == "Bridge") {
     validPL->set<std::string>("Executable", "zzz", "Name of mesoscale code executable file");
     validPL->set<int>("Num Meso PEs", false, "");
+    validPL->set<int>("Meso Batch Size", 0, "Quadrature points per batched meso message (0 = one message per point)");
   }
 
   return validPL;
@@ -113,6 +113,7 @@ class MesoScaleLinkProblem : public Albany::AbstractProblem {
     const Albany_MPI_Comm mpi_comm;
     Teuchos::RCP<MPI_Comm> interCommunicator;
     int numMesoPEs;
+    int mesoBatchSize;
 
     Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::RCP<Kokkos::DynRankView<RealType, PHX::Device> > > > oldState;
     Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::RCP<Kokkos::DynRankView<RealType, PHX::Device> > > > newState;
@@ -360,6 +361,7 @@ Albany::MesoScaleLinkProblem::constructEvaluators(
     // MPI stuff
     p->set< RCP<MPI_Comm> >("MPALE Intercommunicator", interCommunicator);
     p->set<int>("Num Meso PEs", numMesoPEs);
+    p->set<int>("Meso Batch Size", mesoBatchSize);
 
     //Output
     p->set<std::string>("Stress Name", "Stress"); //dl->qp_tensor also
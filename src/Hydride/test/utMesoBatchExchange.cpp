@@ -0,0 +1,140 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include <mpi.h>
+#include <unistd.h>
+#include <limits>
+#include <numeric>
+#include "MultiScaleStress.hpp"
+#include "MesoBatchExchange.hpp"
+
+//
+// Exercise the STRESS_BATCH protocol against a mock meso server. Rank 0 of
+// MPI_COMM_WORLD plays the macro side, the other ranks play the meso PEs and
+// answer every batch with 2 * x + 1. Run with 2 or more ranks; with a single
+// rank there is no meso side and the tests are skipped. The first meso PE is
+// slowed down, so with 2 or more meso PEs (3 or more ranks, the CTest entry
+// uses 4) the batches are not handed out round robin.
+//
+namespace
+{
+
+// Answer STRESS_BATCH messages until DIE, then report the number of batches
+// served back to the macro side.
+void
+mockMesoServer(MPI_Comm inter, int batchSize, int numStates, int pointSize)
+{
+  int served = 0;
+  int rank;
+  MPI_Comm_rank(inter, &rank);
+
+  while (true) {
+    MPI_Status status;
+    MPI_Probe(0, MPI_ANY_TAG, inter, &status);
+
+    if (status.MPI_TAG == LCM::DIE) {
+      int dummy;
+      MPI_Recv(&dummy, 1, MPI_INT, 0, LCM::DIE, inter, MPI_STATUS_IGNORE);
+      MPI_Send(&served, 1, MPI_INT, 0, LCM::DIE, inter);
+      return;
+    }
+
+    int len;
+    MPI_Get_count(&status, MPI_DOUBLE, &len);
+    std::vector<double> buf(len);
+    MPI_Recv(&buf[0], len, MPI_DOUBLE, 0, LCM::STRESS_BATCH, inter,
+             MPI_STATUS_IGNORE);
+
+    // A malformed header is answered with NaNs so the macro side fails
+    int n = static_cast<int>(buf[0]);
+    bool ok = n >= 1 && n <= batchSize &&
+              static_cast<int>(buf[1]) == numStates &&
+              len == 2 + n * pointSize;
+    for (int i = 2; i < len; ++i)
+      buf[i] = ok ? 2.0 * buf[i] + 1.0 : std::numeric_limits<double>::quiet_NaN();
+
+    if (rank == 0) usleep(2000);
+
+    MPI_Send(&buf[0], len, MPI_DOUBLE, 0, LCM::STRESS_BATCH, inter);
+    ++served;
+  }
+}
+
+void
+runExchange(int numPts, int numStates, int batchSize,
+            Teuchos::FancyOStream& out, bool& success)
+{
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  if (size < 2) {
+    out << "Needs at least 2 ranks, skipping" << std::endl;
+    return;
+  }
+
+  int const is_macro = rank == 0 ? 1 : 0;
+  MPI_Comm local, inter;
+  MPI_Comm_split(MPI_COMM_WORLD, is_macro, rank, &local);
+  MPI_Intercomm_create(local, 0, MPI_COMM_WORLD, is_macro ? 1 : 0, 0, &inter);
+
+  int const numMesoPEs = size - 1;
+  int const pointSize = numStates * 9;
+
+  if (is_macro) {
+    std::vector<double> statesIn(numPts * pointSize), statesOut(statesIn.size(), 0.0);
+    for (std::size_t i = 0; i < statesIn.size(); ++i)
+      statesIn[i] = 0.5 * i - 3.0;
+
+    LCM::exchangeMesoBatches(statesIn, statesOut, numPts, numStates, pointSize,
+                             batchSize, numMesoPEs, LCM::STRESS_BATCH, inter);
+
+    for (std::size_t i = 0; i < statesIn.size(); ++i)
+      TEST_FLOATING_EQUALITY(statesOut[i], 2.0 * statesIn[i] + 1.0, 1.0e-14);
+
+    std::vector<int> served(numMesoPEs);
+    for (int proc = 0; proc < numMesoPEs; ++proc) {
+      int dummy = 0;
+      MPI_Send(&dummy, 1, MPI_INT, proc, LCM::DIE, inter);
+      MPI_Recv(&served[proc], 1, MPI_INT, proc, LCM::DIE, inter,
+               MPI_STATUS_IGNORE);
+    }
+
+    int const numBatches = (numPts + batchSize - 1) / batchSize;
+    TEST_EQUALITY(std::accumulate(served.begin(), served.end(), 0), numBatches);
+  }
+  else
+    mockMesoServer(inter, batchSize, numStates, pointSize);
+
+  MPI_Comm_free(&inter);
+  MPI_Comm_free(&local);
+}
+
+TEUCHOS_UNIT_TEST(MesoBatchExchange, BatchSizeOne)
+{
+  runExchange(7, 1, 1, out, success);
+}
+
+TEUCHOS_UNIT_TEST(MesoBatchExchange, BatchSizeN)
+{
+  // 23 points in batches of 4: the last batch is short, and the number of
+  // batches is not a multiple of the number of meso PEs
+  runExchange(23, 1, 4, out, success);
+}
+
+TEUCHOS_UNIT_TEST(MesoBatchExchange, BatchSizeNWithPerturbations)
+{
+  // Base state plus 3 finite-difference perturbations per point
+  runExchange(23, 4, 4, out, success);
+}
+
+TEUCHOS_UNIT_TEST(MesoBatchExchange, BatchLargerThanWorkset)
+{
+  runExchange(5, 1, 16, out, success);
+}
+
+} // namespace
@@ -113,8 +113,17 @@ evaluateFields(typename Traits::EvalData workset)
       // Note: The freezing curve is a simple linear relationship that is sharp
       // at the T_low and T_high points. I don't know if this will actually
       // cause problems or not. If it does, we can try a curved relationship.    
-      dfdT_(cell, qp) = (ice_saturation_evaluated_(cell, qp) - f_old) / 
-                        delta_temperature_(cell, qp);
+      // Without a temperature change (e.g. the initial guess of a step is the
+      // last converged solution) the slope of the curve itself is used.
+      if (delta_temperature_(cell, qp) == 0.0) {
+        dfdT_(cell, qp) = 0.0;
+        if ((Temperature(cell,qp) > T_low) && (Temperature(cell,qp) < T_high)) {
+          dfdT_(cell, qp) = -1.0/temperature_range_;
+        }
+      } else {
+        dfdT_(cell, qp) = (ice_saturation_evaluated_(cell, qp) - f_old) / 
+                          delta_temperature_(cell, qp);
+      }
     }
   }
 
@@ -72,8 +72,8 @@ class ACEiceSaturation : public PHX::EvaluatorWithBaseImpl<Traits>,
   PHX::MDField<ScalarT, Cell, QuadPoint> ice_saturation_;
   
   // MDFields that ice saturation depends on
-  PHX::MDField<ScalarT, Cell, QuadPoint> delta_temperature_;
-  PHX::MDField<ScalarT, Cell, QuadPoint> dfdT_;
+  PHX::MDField<const ScalarT, Cell, QuadPoint> delta_temperature_;
+  PHX::MDField<const ScalarT, Cell, QuadPoint> dfdT_;
 
   ///
   /// Contains the initial ice saturation value
@@ -86,9 +86,9 @@ class ACEiceSaturation : public PHX::EvaluatorWithBaseImpl<Traits>,
   ScalarT max_ice_saturation_{0.95};
 
   ///
-  /// Contains the ice saturation from last timestep
+  /// State name of the ice saturation from last timestep
   ///
-  PHX::MDField<ScalarT, Cell, QuadPoint> ice_saturation_old_;
+  std::string ice_saturation_old_name_;
 
 };
 }  // namespace LCM
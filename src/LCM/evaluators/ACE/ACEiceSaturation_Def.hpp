@@ -41,6 +41,8 @@ ACEiceSaturation<EvalT, Traits>::ACEiceSaturation(
   max_ice_saturation_ = 
       iceSaturation_list->get<double>("Maximum Ice Saturation");
 
+  ice_saturation_old_name_ = p.get<std::string>("ACE Ice Saturation") + "_old";
+
   // Add ice saturation as Sacado-ized parameters
   this->registerSacadoParameter("ACE Ice Saturation", paramLib);
 
@@ -48,8 +50,8 @@ ACEiceSaturation<EvalT, Traits>::ACEiceSaturation(
   this->addEvaluatedField(ice_saturation_);
   
   // List dependent fields
-  this->addEvaluatedField(delta_temperature_); 
-  this->addEvaluatedField(dfdT_); 
+  this->addDependentField(delta_temperature_); 
+  this->addDependentField(dfdT_); 
 
   this->setName("ACE Ice Saturation" + PHX::typeAsString<EvalT>());
 }
@@ -77,19 +79,22 @@ evaluateFields(typename Traits::EvalData workset)
 {
   int num_cells = workset.numCells;
 
+  // The ice saturation of the last converged step, saved as a state
+  Albany::MDArray const
+  ice_saturation_old = (*workset.stateArrayPtr)[ice_saturation_old_name_];
+
   for (int cell = 0; cell < num_cells; ++cell) {
     for (int qp = 0; qp < num_qps_; ++qp) {
       
-      ice_saturation_(cell, qp) += 
+      ScalarT
+      ice = ice_saturation_old(cell, qp) +
           dfdT_(cell, qp) * delta_temperature_(cell, qp);
           
       // check on realistic bounds
-      ice_saturation_(cell, qp) = std::max(0.0, ice_saturation_(cell, qp));
-      ice_saturation_(cell, qp) = std::min(
-          max_ice_saturation_, ice_saturation_(cell, qp));
-      
-      // swap ice saturations
-      ice_saturation_old_(cell, qp) = ice_saturation_(cell, qp); 
+      if (ice < 0.0) ice = 0.0;
+      if (ice > max_ice_saturation_) ice = max_ice_saturation_;
+
+      ice_saturation_(cell, qp) = ice;
     }
   }
 
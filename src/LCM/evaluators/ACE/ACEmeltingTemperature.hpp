@@ -23,8 +23,7 @@ namespace LCM {
 template <typename EvalT, typename Traits>
 class ACEmeltingTemperature :
           public PHX::EvaluatorWithBaseImpl<Traits>,
-          public PHX::EvaluatorDerived<EvalT, Traits>,
-          public Sacado::ParameterAccessor<EvalT, SPL_Traits> {
+          public PHX::EvaluatorDerived<EvalT, Traits> {
  public:
 
   using ScalarT          = typename EvalT::ScalarT;
@@ -50,12 +49,6 @@ class ACEmeltingTemperature :
   void
   evaluateFields(typename Traits::EvalData workset);
 
-  ///
-  /// Sacado method to access parameters
-  ///
-  //ScalarT&
-  //getValue(const std::string& n);
-
  private:
 
   ///
@@ -32,15 +32,9 @@ ACEmeltingTemperature<EvalT, Traits>::ACEmeltingTemperature(
   num_qps_  = dims[1];
   num_dims_ = dims[2];
 
-  Teuchos::RCP<ParamLib> paramLib =
-    p.get< Teuchos::RCP<ParamLib>>("Parameter Library", Teuchos::null);
-
   // Read melting temperature values
   //rho_ice_ = melting_temp_p_list->get<double>("Ice Value");
 
-  // Add melting temperature as a Sacado-ized parameter
-  this->registerSacadoParameter("ACE Melting Temperature", paramLib);
-
   // List evaluated fields
   this->addEvaluatedField(melting_temperature_);
   
@@ -95,24 +89,4 @@ evaluateFields(typename Traits::EvalData workset)
   return;
 }
 
-//
-//template <typename EvalT, typename Traits>
-//typename ACEmeltingTemperature<EvalT, Traits>::ScalarT&
-//ACEmeltingTemperature<EvalT, Traits>::getValue(const std::string& n)
-//{
-//  if (n == "ACE Ice Density") {
-//    return rho_ice_;
-//  }
-//  if (n == "ACE Water Density") {
-//    return rho_wat_;
-//  }
-//  if (n == "ACE Sediment Density") {
-//    return rho_sed_;
-//  }
-//
-//  ALBANY_ASSERT(false, "Invalid request for value of ACE Component Density");
-//
-//  return rho_wat_; // does it matter what we return here?
-//}
-
 }  // namespace LCM
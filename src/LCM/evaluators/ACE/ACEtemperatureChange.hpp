@@ -23,8 +23,7 @@ namespace LCM {
 template <typename EvalT, typename Traits>
 class ACEtemperatureChange
    : public PHX::EvaluatorWithBaseImpl<Traits>,
-     public PHX::EvaluatorDerived<EvalT, Traits>,
-     public Sacado::ParameterAccessor<EvalT, SPL_Traits> {
+     public PHX::EvaluatorDerived<EvalT, Traits> {
  public:
   using ScalarT = typename EvalT::ScalarT;
 
@@ -63,9 +62,11 @@ class ACEtemperatureChange
 
   // MDField  that aid temperature change calculation
   PHX::MDField<const ScalarT, Cell, QuadPoint> Temperature;
-  PHX::MDField<ScalarT, Cell, QuadPoint> temperature_old_;
-  PHX::MDField<bool, Cell, QuadPoint> temp_increasing_;
-  PHX::MDField<bool, Cell, QuadPoint> temp_decreasing_;
+
+  ///
+  /// State name of the temperature of the last converged step
+  ///
+  std::string temperature_old_name_;
 
   ///
   /// Contains the temperature change
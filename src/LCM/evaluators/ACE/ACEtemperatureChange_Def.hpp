@@ -30,15 +30,11 @@ ACEtemperatureChange<EvalT, Traits>::ACEtemperatureChange(
   num_qps_  = dims[1];
   num_dims_ = dims[2];
 
-  Teuchos::RCP<ParamLib> paramLib =
-    p.get< Teuchos::RCP<ParamLib>>("Parameter Library", Teuchos::null);
-    
   // Read parameter values from input
   //min_water_saturation_ = 
   //    temperatureChange_list->get<double>("Minimum Water Saturation");
 
-  // Add temperature change as Sacado-ized parameters
-  this->registerSacadoParameter("ACE Temperature Change", paramLib);
+  temperature_old_name_ = p.get<std::string>("Temperature Name") + "_old";
 
   // List evaluated fields
   this->addEvaluatedField(delta_temperature_);
@@ -63,7 +59,8 @@ ACEtemperatureChange<EvalT, Traits>::postRegistrationSetup(
 }
 
 
-// This function updates the temperature change since the last time step.
+// This function computes the temperature change since the last time step.
+// The old temperature is the state saved at the last converged step.
 template <typename EvalT, typename Traits>
 void
 ACEtemperatureChange<EvalT, Traits>::
@@ -71,25 +68,13 @@ evaluateFields(typename Traits::EvalData workset)
 {
   int num_cells = workset.numCells;
 
+  Albany::MDArray const
+  temperature_old = (*workset.stateArrayPtr)[temperature_old_name_];
+
   for (int cell = 0; cell < num_cells; ++cell) {
     for (int qp = 0; qp < num_qps_; ++qp) {
       delta_temperature_(cell, qp) = 
-          Temperature(cell, qp) - temperature_old_(cell, qp);
-      // Swap temperatures now
-      temperature_old_(cell, qp) = Temperature(cell, qp);      
-      // set Boolean fields
-      if (delta_temperature_(cell, qp) > 0.0) {
-        temp_increasing_(cell, qp) = true;
-        temp_decreasing_(cell, qp) = false;
-      }
-      else if (delta_temperature_(cell, qp) < 0.0) {
-        temp_increasing_(cell, qp) = false;
-        temp_decreasing_(cell, qp) = true;
-      }
-      else {
-        temp_increasing_(cell, qp) = false;
-        temp_decreasing_(cell, qp) = false;
-      }
+          Temperature(cell, qp) - temperature_old(cell, qp);
     }
   }
 
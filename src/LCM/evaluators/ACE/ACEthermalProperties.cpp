@@ -0,0 +1,12 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "PHAL_AlbanyTraits.hpp"
+
+#include "ACEthermalProperties.hpp"
+#include "ACEthermalProperties_Def.hpp"
+
+PHAL_INSTANTIATE_TEMPLATE_CLASS(LCM::ACEthermalProperties)
@@ -0,0 +1,135 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(ACEthermalProperties_hpp)
+#define ACEthermalProperties_hpp
+
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_MDField.hpp"
+#include "Phalanx_config.hpp"
+
+#include "Sacado_ParameterAccessor.hpp"
+#include "Teuchos_Array.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+namespace LCM {
+///
+/// Evaluates the whole ACE permafrost property chain at integration points
+/// in a single pass: melting temperature, temperature change, freezing
+/// curve, ice and water saturation, porosity, density, heat capacity,
+/// thermal conductivity and thermal inertia. The formulas are those of the
+/// individual ACE evaluators; the intermediate quantities stay local to
+/// the quadrature point loop unless "Output Intermediate Fields" is set.
+/// The temperature and ice saturation of the last converged step are read
+/// from the "_old" states, so both must be registered with the StateManager.
+///
+template <typename EvalT, typename Traits>
+class ACEthermalProperties
+    : public PHX::EvaluatorWithBaseImpl<Traits>,
+      public PHX::EvaluatorDerived<EvalT, Traits>,
+      public Sacado::ParameterAccessor<EvalT, SPL_Traits> {
+ public:
+
+  using ScalarT          = typename EvalT::ScalarT;
+
+  ///
+  /// Constructor
+  ///
+  ACEthermalProperties(
+      Teuchos::ParameterList&              p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
+
+  ///
+  /// Phalanx method to allocate space
+  ///
+  void
+  postRegistrationSetup(
+      typename Traits::SetupData d,
+      PHX::FieldManager<Traits>& vm);
+
+  ///
+  /// Calculates all ACE thermal properties
+  ///
+  void
+  evaluateFields(typename Traits::EvalData workset);
+
+  ///
+  /// Sacado method to access parameters
+  ///
+  ScalarT&
+  getValue(const std::string& n);
+
+ private:
+
+  ///
+  /// Number of integration points
+  ///
+  int num_qps_{0};
+
+  ///
+  /// Number of problem dimensions
+  ///
+  int num_dims_{0};
+
+  ///
+  /// Whether the intermediate quantities are written to their fields
+  ///
+  bool output_intermediate_{false};
+
+  // Inputs
+  PHX::MDField<ScalarT const, Cell, QuadPoint> temperature_;
+  PHX::MDField<ScalarT const, Cell, QuadPoint> pressure_;
+  PHX::MDField<ScalarT const, Cell, QuadPoint> salinity_;
+
+  // Outputs always evaluated; the ice saturation is saved as a state
+  PHX::MDField<ScalarT, Cell, QuadPoint> thermal_conductivity_;
+  PHX::MDField<ScalarT, Cell, QuadPoint> thermal_inertia_;
+  PHX::MDField<ScalarT, Cell, QuadPoint> ice_saturation_;
+
+  // Outputs evaluated only with "Output Intermediate Fields"
+  PHX::MDField<ScalarT, Cell, QuadPoint> melting_temperature_;
+  PHX::MDField<ScalarT, Cell, QuadPoint> delta_temperature_;
+  PHX::MDField<ScalarT, Cell, QuadPoint> ice_saturation_evaluated_;
+  PHX::MDField<ScalarT, Cell, QuadPoint> dfdT_;
+  PHX::MDField<ScalarT, Cell, QuadPoint> water_saturation_;
+  PHX::MDField<ScalarT, Cell, QuadPoint> porosity_;
+  PHX::MDField<ScalarT, Cell, QuadPoint> density_;
+  PHX::MDField<ScalarT, Cell, QuadPoint> heat_capacity_;
+
+  // State names of the old temperature and ice saturation
+  std::string temperature_old_name_;
+  std::string ice_saturation_old_name_;
+
+  // Component values, constant
+  ScalarT rho_ice_{0.0};
+  ScalarT rho_wat_{0.0};
+  ScalarT rho_sed_{0.0};
+  ScalarT cp_ice_{0.0};
+  ScalarT cp_wat_{0.0};
+  ScalarT cp_sed_{0.0};
+  ScalarT k_ice_{0.0};
+  ScalarT k_wat_{0.0};
+  ScalarT k_sed_{0.0};
+
+  // Thermal inertia
+  ScalarT latent_heat_{0.0};
+  ScalarT rho_ice_inertia_{0.0};
+
+  // Porosity
+  bool    porosity_is_constant_{true};
+  ScalarT constant_porosity_{0.0};
+  ScalarT surface_porosity_{0.0};
+  ScalarT efolding_depth_{0.0};
+
+  // Freezing curve and saturation bounds
+  ScalarT temperature_range_{0.0};
+  ScalarT max_ice_saturation_{0.0};
+  ScalarT min_water_saturation_{0.0};
+};
+}  // namespace LCM
+
+#endif  // ACEthermalProperties_hpp
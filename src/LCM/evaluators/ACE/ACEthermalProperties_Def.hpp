@@ -0,0 +1,371 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <cmath>
+#include "Albany_Utils.hpp"
+#include "Phalanx_DataLayout.hpp"
+#include "Teuchos_TestForException.hpp"
+
+namespace LCM {
+
+template <typename EvalT, typename Traits>
+ACEthermalProperties<EvalT, Traits>::ACEthermalProperties(
+    Teuchos::ParameterList&              p,
+    const Teuchos::RCP<Albany::Layouts>& dl)
+    : temperature_(  // dependent
+          p.get<std::string>("Temperature Name"), dl->qp_scalar),
+      pressure_(  // dependent
+          p.get<std::string>("ACE Pressure"), dl->qp_scalar),
+      salinity_(  // dependent
+          p.get<std::string>("ACE Salinity"), dl->qp_scalar),
+      thermal_conductivity_(  // evaluated
+          p.get<std::string>("ACE Thermal Conductivity"), dl->qp_scalar),
+      thermal_inertia_(  // evaluated
+          p.get<std::string>("ACE Thermal Inertia"), dl->qp_scalar),
+      ice_saturation_(  // evaluated
+          p.get<std::string>("ACE Ice Saturation"), dl->qp_scalar),
+      melting_temperature_(  // optionally evaluated
+          p.get<std::string>("ACE Melting Temperature"), dl->qp_scalar),
+      delta_temperature_(  // optionally evaluated
+          p.get<std::string>("ACE Temperature Change"), dl->qp_scalar),
+      ice_saturation_evaluated_(  // optionally evaluated
+          p.get<std::string>("ACE Evaluated Ice Saturation"), dl->qp_scalar),
+      dfdT_(  // optionally evaluated
+          p.get<std::string>("ACE Freezing Curve Slope"), dl->qp_scalar),
+      water_saturation_(  // optionally evaluated
+          p.get<std::string>("ACE Water Saturation"), dl->qp_scalar),
+      porosity_(  // optionally evaluated
+          p.get<std::string>("ACE Porosity"), dl->qp_scalar),
+      density_(  // optionally evaluated
+          p.get<std::string>("ACE Density"), dl->qp_scalar),
+      heat_capacity_(  // optionally evaluated
+          p.get<std::string>("ACE Heat Capacity"), dl->qp_scalar)
+{
+  Teuchos::ParameterList* properties_list =
+    p.get<Teuchos::ParameterList*>("Parameter List");
+
+  Teuchos::RCP<PHX::DataLayout> vector_dl =
+    p.get< Teuchos::RCP<PHX::DataLayout>>("QP Vector Data Layout");
+  std::vector<PHX::DataLayout::size_type> dims;
+  vector_dl->dimensions(dims);
+  num_qps_  = dims[1];
+  num_dims_ = dims[2];
+
+  Teuchos::RCP<ParamLib> paramLib =
+    p.get< Teuchos::RCP<ParamLib>>("Parameter Library", Teuchos::null);
+
+  output_intermediate_ =
+      properties_list->get<bool>("Output Intermediate Fields", false);
+
+  temperature_old_name_ = p.get<std::string>("Temperature Name") + "_old";
+  ice_saturation_old_name_ = p.get<std::string>("ACE Ice Saturation") + "_old";
+
+  // Each sublist holds the same entries as the "Parameter List" of the
+  // corresponding individual ACE evaluator.
+  Teuchos::ParameterList& density_list =
+      properties_list->sublist("ACE Density");
+  rho_ice_ = density_list.get<double>("Ice Value");
+  rho_wat_ = density_list.get<double>("Water Value");
+  rho_sed_ = density_list.get<double>("Sediment Value");
+
+  Teuchos::ParameterList& heat_capacity_list =
+      properties_list->sublist("ACE Heat Capacity");
+  cp_ice_ = heat_capacity_list.get<double>("Ice Value");
+  cp_wat_ = heat_capacity_list.get<double>("Water Value");
+  cp_sed_ = heat_capacity_list.get<double>("Sediment Value");
+
+  Teuchos::ParameterList& thermal_conductivity_list =
+      properties_list->sublist("ACE Thermal Conductivity");
+  k_ice_ = thermal_conductivity_list.get<double>("Ice Value");
+  k_wat_ = thermal_conductivity_list.get<double>("Water Value");
+  k_sed_ = thermal_conductivity_list.get<double>("Sediment Value");
+
+  Teuchos::ParameterList& thermal_inertia_list =
+      properties_list->sublist("ACE Thermal Inertia");
+  latent_heat_ =
+      thermal_inertia_list.get<double>("ACE Latent Heat of Phase Change");
+  rho_ice_inertia_ = thermal_inertia_list.get<double>("ACE Ice Density");
+
+  Teuchos::ParameterList& porosity_list =
+      properties_list->sublist("ACE Porosity");
+  std::string const &
+  type = porosity_list.get<std::string>("Porosity Type");
+  if (type == "Constant") {
+    porosity_is_constant_ = true;
+    constant_porosity_ = porosity_list.get<double>("Value");
+  }
+  else if (type == "Depth-Dependent"){
+    porosity_is_constant_ = false;
+    surface_porosity_ = porosity_list.get<double>("Surface Porosity");
+    efolding_depth_ = porosity_list.get<double>("E-Depth");
+  }
+  else {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        true, Teuchos::Exceptions::InvalidParameter,
+        "Invalid Porosity Type " << type);
+  }
+
+  Teuchos::ParameterList& freezing_curve_list =
+      properties_list->sublist("ACE Freezing Curve");
+  temperature_range_ =
+      freezing_curve_list.get<double>("Phase Change Temperature Range");
+
+  Teuchos::ParameterList& ice_saturation_list =
+      properties_list->sublist("ACE Ice Saturation");
+  max_ice_saturation_ =
+      ice_saturation_list.get<double>("Maximum Ice Saturation");
+
+  Teuchos::ParameterList& water_saturation_list =
+      properties_list->sublist("ACE Water Saturation");
+  min_water_saturation_ =
+      water_saturation_list.get<double>("Minimum Water Saturation");
+
+  // Add component values as Sacado-ized parameters
+  if (paramLib != Teuchos::null) {
+    char const* const
+    names[] = {"ACE Ice Density", "ACE Water Density",
+               "ACE Sediment Density", "ACE Ice Heat Capacity",
+               "ACE Water Heat Capacity", "ACE Sediment Heat Capacity",
+               "ACE Ice Thermal Conductivity",
+               "ACE Water Thermal Conductivity",
+               "ACE Sediment Thermal Conductivity",
+               "ACE Latent Heat of Phase Change",
+               "Phase Change Temperature Range", "Maximum Ice Saturation",
+               "Minimum Water Saturation"};
+    for (auto name : names) {
+      this->registerSacadoParameter(name, paramLib);
+    }
+  }
+
+  // List evaluated fields
+  this->addEvaluatedField(thermal_conductivity_);
+  this->addEvaluatedField(thermal_inertia_);
+  this->addEvaluatedField(ice_saturation_);
+  if (output_intermediate_ == true) {
+    this->addEvaluatedField(melting_temperature_);
+    this->addEvaluatedField(delta_temperature_);
+    this->addEvaluatedField(ice_saturation_evaluated_);
+    this->addEvaluatedField(dfdT_);
+    this->addEvaluatedField(water_saturation_);
+    this->addEvaluatedField(porosity_);
+    this->addEvaluatedField(density_);
+    this->addEvaluatedField(heat_capacity_);
+  }
+
+  // List dependent fields
+  this->addDependentField(temperature_);
+  this->addDependentField(pressure_);
+  this->addDependentField(salinity_);
+
+  this->setName("ACE Thermal Properties" + PHX::typeAsString<EvalT>());
+}
+
+//
+template <typename EvalT, typename Traits>
+void
+ACEthermalProperties<EvalT, Traits>::postRegistrationSetup(
+    typename Traits::SetupData d,
+    PHX::FieldManager<Traits>& fm)
+{
+  // List all fields
+  this->utils.setFieldData(temperature_, fm);
+  this->utils.setFieldData(pressure_, fm);
+  this->utils.setFieldData(salinity_, fm);
+  this->utils.setFieldData(thermal_conductivity_, fm);
+  this->utils.setFieldData(thermal_inertia_, fm);
+  this->utils.setFieldData(ice_saturation_, fm);
+  if (output_intermediate_ == true) {
+    this->utils.setFieldData(melting_temperature_, fm);
+    this->utils.setFieldData(delta_temperature_, fm);
+    this->utils.setFieldData(ice_saturation_evaluated_, fm);
+    this->utils.setFieldData(dfdT_, fm);
+    this->utils.setFieldData(water_saturation_, fm);
+    this->utils.setFieldData(porosity_, fm);
+    this->utils.setFieldData(density_, fm);
+    this->utils.setFieldData(heat_capacity_, fm);
+  }
+  return;
+}
+
+// One pass over the quadrature points evaluates the complete chain. Each
+// step uses the same expression as the corresponding ACE evaluator.
+template <typename EvalT, typename Traits>
+void
+ACEthermalProperties<EvalT, Traits>::evaluateFields(
+    typename Traits::EvalData workset)
+{
+  int const
+  num_cells = workset.numCells;
+
+  // Values of the last converged step
+  Albany::MDArray const
+  temperature_old = (*workset.stateArrayPtr)[temperature_old_name_];
+
+  Albany::MDArray const
+  ice_saturation_old = (*workset.stateArrayPtr)[ice_saturation_old_name_];
+
+  // salinity residual not written yet
+  double const
+  sal = 0.10;
+
+  double const
+  sal15 = std::sqrt(sal * sal * sal);
+
+  double const
+  z = 1.0;  // this is the depth -> how to construct this from cell & qp?
+
+  for (int cell = 0; cell < num_cells; ++cell) {
+    for (int qp = 0; qp < num_qps_; ++qp) {
+
+      ScalarT const
+      T = temperature_(cell, qp);
+
+      // Melting temperature
+      ScalarT const
+      Tm = (-0.057 * sal) + (0.00170523 * sal15) -
+           (0.0002154996 * sal * sal) -
+           ((0.000753/10000.0) * pressure_(cell, qp));
+
+      // Temperature change
+      ScalarT const
+      dT = T - temperature_old(cell, qp);
+
+      // Freezing curve
+      ScalarT const
+      T_low = Tm - (temperature_range_/2.0);
+
+      ScalarT const
+      T_high = Tm + (temperature_range_/2.0);
+
+      ScalarT
+      ice_eval = 0.0;
+
+      if (T <= T_low) {
+        ice_eval = 1.0;
+      }
+      if (T >= T_high) {
+        ice_eval = 0.0;
+      }
+      if ((T > T_low) && (T < T_high)) {
+        ice_eval = -1.0*(T/temperature_range_) + T_high;
+      }
+
+      // Slope of the curve itself when the temperature does not change
+      ScalarT
+      dfdT = 0.0;
+
+      if (dT == 0.0) {
+        if ((T > T_low) && (T < T_high)) dfdT = -1.0/temperature_range_;
+      } else {
+        dfdT = (ice_eval - 0.0) / dT;
+      }
+
+      // Ice saturation, within realistic bounds
+      ScalarT
+      ice = ice_saturation_old(cell, qp) + dfdT * dT;
+
+      if (ice < 0.0) ice = 0.0;
+      if (ice > max_ice_saturation_) ice = max_ice_saturation_;
+
+      // Water saturation, within realistic bounds
+      ScalarT
+      water = 1.0 - ice;
+
+      if (water < min_water_saturation_) water = min_water_saturation_;
+      if (water > 1.0) water = 1.0;
+
+      // Porosity
+      ScalarT const
+      phi = porosity_is_constant_ == true ?
+          constant_porosity_ :
+          ScalarT(surface_porosity_*exp(-1.0*z/efolding_depth_));
+
+      // Mixture model density and heat capacity
+      ScalarT const
+      rho = phi*(rho_ice_*ice + rho_wat_*water) + ((1.0-phi)*rho_sed_);
+
+      ScalarT const
+      cp = phi*(cp_ice_*ice + cp_wat_*water) + ((1.0-phi)*cp_sed_);
+
+      thermal_conductivity_(cell, qp) =
+          pow(k_ice_,(ice*phi)) *
+          pow(k_wat_,(water*phi)) *
+          pow(k_sed_,(1.0-phi));
+
+      thermal_inertia_(cell, qp) =
+          (rho * cp) - (rho_ice_inertia_ * latent_heat_ * dfdT);
+
+      ice_saturation_(cell, qp) = ice;
+
+      if (output_intermediate_ == true) {
+        melting_temperature_(cell, qp) = Tm;
+        delta_temperature_(cell, qp) = dT;
+        ice_saturation_evaluated_(cell, qp) = ice_eval;
+        dfdT_(cell, qp) = dfdT;
+        water_saturation_(cell, qp) = water;
+        porosity_(cell, qp) = phi;
+        density_(cell, qp) = rho;
+        heat_capacity_(cell, qp) = cp;
+      }
+    }
+  }
+
+  return;
+}
+
+//
+template <typename EvalT, typename Traits>
+typename ACEthermalProperties<EvalT, Traits>::ScalarT&
+ACEthermalProperties<EvalT, Traits>::getValue(const std::string& n)
+{
+  if (n == "ACE Ice Density") {
+    return rho_ice_;
+  }
+  if (n == "ACE Water Density") {
+    return rho_wat_;
+  }
+  if (n == "ACE Sediment Density") {
+    return rho_sed_;
+  }
+  if (n == "ACE Ice Heat Capacity") {
+    return cp_ice_;
+  }
+  if (n == "ACE Water Heat Capacity") {
+    return cp_wat_;
+  }
+  if (n == "ACE Sediment Heat Capacity") {
+    return cp_sed_;
+  }
+  if (n == "ACE Ice Thermal Conductivity") {
+    return k_ice_;
+  }
+  if (n == "ACE Water Thermal Conductivity") {
+    return k_wat_;
+  }
+  if (n == "ACE Sediment Thermal Conductivity") {
+    return k_sed_;
+  }
+  if (n == "ACE Latent Heat of Phase Change") {
+    return latent_heat_;
+  }
+  if (n == "Phase Change Temperature Range") {
+    return temperature_range_;
+  }
+  if (n == "Maximum Ice Saturation") {
+    return max_ice_saturation_;
+  }
+  if (n == "Minimum Water Saturation") {
+    return min_water_saturation_;
+  }
+
+  ALBANY_ASSERT(
+      false,
+      "Invalid request for value of ACE Thermal Properties Parameter");
+
+  return rho_wat_; // does it matter what we return here?
+}
+
+}  // namespace LCM
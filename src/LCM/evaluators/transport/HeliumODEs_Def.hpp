@@ -8,6 +8,8 @@
 #include <Phalanx_DataLayout.hpp>
 #include <MiniTensor.h>
 #include "Albany_MaterialDatabase.hpp"
+#include "Albany_Utils.hpp"
+#include "MiniNonlinearSolver.h"
 
 namespace LCM
 {
@@ -102,25 +104,175 @@ postRegistrationSetup(typename Traits::SetupData d,
 
 }
 
+//------------------------------------------------------------------------------
+//
+// Backward Euler residual of the Helium ODEs. The unknowns are the He
+// concentration, the total bubble density and the bubble volume fraction.
+//
+template<typename EvalT, minitensor::Index M = 3>
+class HeliumNLS : public minitensor::
+                      Function_Base<HeliumNLS<EvalT, M>, typename EvalT::ScalarT, M>
+{
+  using S = typename EvalT::ScalarT;
+
+ public:
+  HeliumNLS(
+      RealType he_radius,
+      RealType atomic_omega,
+      RealType eta,
+      RealType n1_old,
+      RealType nb_old,
+      RealType sb_old,
+      S const& d,
+      S const& g,
+      S const& dt)
+      : he_radius_(he_radius), atomic_omega_(atomic_omega), eta_(eta),
+        n1_old_(n1_old), nb_old_(nb_old), sb_old_(sb_old), d_(d), g_(g), dt_(dt)
+  {
+  }
+
+  constexpr static char const* const NAME{"Helium ODEs NLS"};
+
+  using Base =
+      minitensor::Function_Base<HeliumNLS<EvalT, M>, typename EvalT::ScalarT, M>;
+
+  // Default value.
+  template<typename T, minitensor::Index N>
+  T
+  value(minitensor::Vector<T, N> const& x)
+  {
+    return Base::value(*this, x);
+  }
+
+  // Explicit gradient, the residual of the ODEs.
+  template<typename T, minitensor::Index N>
+  minitensor::Vector<T, N>
+  gradient(minitensor::Vector<T, N> const& x)
+  {
+    // Firewalls.
+    minitensor::Index const dimension = x.get_dimension();
+
+    ALBANY_EXPECT(dimension == Base::DIMENSION);
+
+    // Variables that potentially have Albany::Traits sensitivity
+    // information need to be handled by the peel functor so that
+    // proper conversions take place.
+    T const d  = peel<EvalT, T, N>()(d_);
+    T const g  = peel<EvalT, T, N>()(g_);
+    T const dt = peel<EvalT, T, N>()(dt_);
+
+    RealType const pi = std::acos(-1.0);
+    RealType const cub_tfpi = std::cbrt(3.0 / 4.0 / pi);
+
+    T const& n1 = x(0);
+    T const& nb = x(1);
+    T const& sb = x(2);
+
+    T const cube_root_nb2 = lcm_cbrt(T(nb * nb));
+    T const cube_root_sb = lcm_cbrt(sb);
+
+    minitensor::Vector<T, N> r(dimension);
+
+    r(0) = n1 - n1_old_
+        - dt * (g - 32.0 * pi * he_radius_ * d * n1 * n1 -
+            4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
+    r(1) = nb - nb_old_ - dt * (16.0 * pi * he_radius_ * d * n1 * n1);
+    r(2) = sb - sb_old_
+        - atomic_omega_ / eta_ * dt * (32. * pi * he_radius_ * d * n1 * n1 +
+            4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
+
+    return r;
+  }
+
+  // Explicit hessian, the tangent of the ODEs.
+  template<typename T, minitensor::Index N>
+  minitensor::Tensor<T, N>
+  hessian(minitensor::Vector<T, N> const& x)
+  {
+    minitensor::Index const dimension = x.get_dimension();
+
+    T const d  = peel<EvalT, T, N>()(d_);
+    T const dt = peel<EvalT, T, N>()(dt_);
+
+    RealType const pi = std::acos(-1.0);
+    RealType const pi2 = pi * pi;
+    RealType const cube_root_pi2 = std::cbrt(pi2);
+    RealType const cube_root_2 = std::cbrt(2.0);
+    RealType const cube_root_6 = std::cbrt(6.0);
+    RealType const cube_root_9 = std::cbrt(9.0);
+    RealType const cube_root_pi2_9 = std::cbrt(pi2 / 9.0);
+
+    T const& n1 = x(0);
+    T const& nb = x(1);
+    T const& sb = x(2);
+
+    // Common factors w/cube_root
+    T const cube_root_nb = lcm_cbrt(nb);
+    T const cube_root_nb2 = lcm_cbrt(T(nb * nb));
+    T const cube_root_sb = lcm_cbrt(sb);
+    T const cube_root_sb2 = lcm_cbrt(T(sb * sb));
+
+    minitensor::Tensor<T, N> tangent(dimension);
+
+    tangent(0, 0) = 1.0
+        + 2.0 * dt * d * (32.0 * n1 * pi * he_radius_ + cube_root_6 *
+            cube_root_nb2 * cube_root_pi2 * cube_root_sb);
+    tangent(0, 1) = 4.0 * cube_root_2 * dt * d * n1 * cube_root_pi2 *
+        cube_root_sb / cube_root_9 / cube_root_nb;
+    tangent(0, 2) = 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 *
+        cube_root_pi2_9 / cube_root_sb2;
+    tangent(1, 0) = -32.0 * dt * d * n1 * pi * he_radius_;
+    tangent(1, 1) = 1.0;
+    tangent(1, 2) = 0.0;
+    tangent(2, 0) = -2.0 * dt * d * atomic_omega_
+        * (32.0 * n1 * pi * he_radius_ + cube_root_6 *
+            cube_root_nb2 * cube_root_pi2 * cube_root_sb) / eta_;
+    tangent(2, 1) = -4.0 * cube_root_2 * dt * d * n1 * atomic_omega_ *
+        cube_root_pi2 * cube_root_sb / cube_root_9 / eta_ / cube_root_nb;
+    tangent(2, 2) = 1.0
+        - 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 *
+            atomic_omega_ * cube_root_pi2_9 / eta_ / cube_root_sb2;
+
+    return tangent;
+  }
+
+  // Constants.
+  RealType const he_radius_{0.0};
+  RealType const atomic_omega_{0.0};
+  RealType const eta_{0.0};
+  RealType const n1_old_{0.0};
+  RealType const nb_old_{0.0};
+  RealType const sb_old_{0.0};
+
+  // Inputs
+  S const& d_;
+  S const& g_;
+  S const& dt_;
+};
+
 //------------------------------------------------------------------------------
 template<typename EvalT, typename Traits>
 void HeliumODEs<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  // The local system is solved with plain values, and the derivatives of the
+  // solution are recovered afterwards from the implicit function theorem.
+  using ValueT = typename Sacado::ValueType<ScalarT>::type;
+  using NLS = HeliumNLS<EvalT>;
+
+  constexpr minitensor::Index nls_dim{NLS::DIMENSION};
+
+  using MIN = minitensor::Minimizer<ValueT, nls_dim>;
+  using STEP = minitensor::NewtonStep<NLS, ValueT, nls_dim>;
+
   // Declaring time step & calculated input parameters
   ScalarT dt;
-  ScalarT atomic_omega;
-  // Declaring tangent, residual, norms, and increment for N-R
-  minitensor::Tensor<ScalarT> tangent(3);
-  minitensor::Vector<ScalarT> residual(3);
-  ScalarT norm_residual_2, norm_residual_goal_2;
-  minitensor::Vector<ScalarT> increment(3);
+  RealType atomic_omega;
 
   // tolarences and iterations for newton
-  const double tolerance = 1.0e-12, tolerance_2 = tolerance * tolerance;
+  const double tolerance = 1.0e-12;
   const int maxIterations = 20; //FIXME: Currently a maximum, need relative measures
   // subincrementation for explicit predictor //FIXME: No guarantee of stability
-  ScalarT dt_explicit;
   const int explicit_sub_increments = 5;
 
   // state old
@@ -155,26 +307,19 @@ evaluateFields(typename Traits::EvalData workset)
 
   // time step
   dt = delta_time_(0);
+  const RealType dt_val = peel<EvalT, RealType, nls_dim>()(dt);
 
   // loop over cells and points for implicit time integration
 
   // constants for computations
   const double pi = acos(-1.0);
-  const double onethrd = 1.0 / 3.0;
-  const double twothrd = 2.0 / 3.0;
   const double cub_tfpi = std::cbrt(3.0 / 4.0 / pi);
 
   // temporary variables
-  ScalarT n1_old, nb_old, sb_old, n1, nb, sb;
-  ScalarT n1_exp, nb_exp, sb_exp;
-  ScalarT d, g_old, g;
-
-  const double pi2 = pi * pi;
-  const double cube_root_pi2 = std::cbrt(pi2);
-  const double cube_root_2 = std::cbrt(2.0);
-  const double cube_root_6 = std::cbrt(6.0);
-  const double cube_root_9 = std::cbrt(9.0);
-  const double cube_root_pi2_9 = std::cbrt(pi2 / 9.0);
+  RealType n1_old, nb_old, sb_old;
+  RealType n1_exp, nb_exp, sb_exp;
+  ScalarT n1, nb, sb;
+  ScalarT d, g;
 
   for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
 
@@ -194,10 +339,13 @@ evaluateFields(typename Traits::EvalData workset)
       if (total_concentration_(cell, pt) > tolerance) {
 
         // source terms for helium bubble generation
-        g_old = avogadros_num_ * t_decay_constant_
+        const RealType g_old = avogadros_num_ * t_decay_constant_
             * total_concentration_old(cell, pt);
         g = avogadros_num_ * t_decay_constant_ * total_concentration_(cell, pt);
 
+        // initial guess, which only needs values
+        RealType n1_0 = n1_old, nb_0 = nb_old, sb_0 = sb_old;
+
         // check if old bubble density is small
         // if small, use an explict guess to avoid issues with 1/nb and 1/sb in tangent
 
@@ -206,109 +354,65 @@ evaluateFields(typename Traits::EvalData workset)
           // explicit time integration for predictor
           // Note that two or more steps are required to obtain a finite nb if the
           // total_concentration_old is zero.
-          dt_explicit = dt / explicit_sub_increments;
+          const RealType d_val = peel<EvalT, RealType, nls_dim>()(d);
+          const RealType dt_explicit = dt_val / explicit_sub_increments;
           n1_exp = n1_old;
           nb_exp = nb_old;
           sb_exp = sb_old;
 
-          const ScalarT nb_exp2 = nb_exp * nb_exp;
-          const ScalarT cube_root_nb_exp2 = lcm_cbrt(nb_exp2);
+          const RealType cube_root_nb_exp2 = lcm_cbrt(nb_exp * nb_exp);
 
           for (int sub_increment = 0; sub_increment < explicit_sub_increments;
               sub_increment++) {
-            n1 = n1_exp
+            n1_0 = n1_exp
                 + dt_explicit
-                    * (g_old - 32.0 * pi * he_radius_ * d * n1_exp * n1_exp
+                    * (g_old - 32.0 * pi * he_radius_ * d_val * n1_exp * n1_exp
                         -
-                        4.0 * pi * d * n1_exp * cub_tfpi * lcm_cbrt(sb_exp)
+                        4.0 * pi * d_val * n1_exp * cub_tfpi * lcm_cbrt(sb_exp)
                             * cube_root_nb_exp2);
-            nb = nb_exp
-                + dt_explicit * (16.0 * pi * he_radius_ * d * n1_exp * n1_exp);
-            sb = sb_exp
+            nb_0 = nb_exp
+                + dt_explicit * (16.0 * pi * he_radius_ * d_val * n1_exp * n1_exp);
+            sb_0 = sb_exp
                 + atomic_omega / eta_ * dt_explicit
-                    * (32. * pi * he_radius_ * d * n1_exp * n1_exp +
-                        4.0 * pi * d * n1_exp * cub_tfpi * lcm_cbrt(sb_exp) *
+                    * (32. * pi * he_radius_ * d_val * n1_exp * n1_exp +
+                        4.0 * pi * d_val * n1_exp * cub_tfpi * lcm_cbrt(sb_exp) *
                             cube_root_nb_exp2);
-            n1_exp = n1;
-            nb_exp = nb;
-            sb_exp = sb;
+            n1_exp = n1_0;
+            nb_exp = nb_0;
+            sb_exp = sb_0;
           }
         }
 
-        ScalarT nb2 = nb * nb;
-        ScalarT cube_root_nb2 = lcm_cbrt(nb2);
-        ScalarT cube_root_sb = lcm_cbrt(sb);
-
-        // calculate initial residual for a relative tolerance
-        residual(0) = n1 - n1_old
-            - dt * (g - 32.0 * pi * he_radius_ * d * n1 * n1 -
-                4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-        residual(1) = nb - nb_old - dt * (16.0 * pi * he_radius_ * d * n1 * n1);
-        residual(2) = sb - sb_old
-            - atomic_omega / eta_ * dt * (32. * pi * he_radius_ * d * n1 * n1 +
-                4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-        norm_residual_2 = minitensor::norm_square(residual);
-        norm_residual_goal_2 = tolerance_2 * norm_residual_2;
-        int iter(0);
-
-        // N-R loop for implicit time integration
-        while (norm_residual_2 > norm_residual_goal_2 && iter < maxIterations) {
-
-          // Common factors w/cube_root
-          ScalarT cube_root_nb = lcm_cbrt(nb);
-          nb2 = nb * nb;
-          cube_root_nb2 = lcm_cbrt(nb2);
-          cube_root_sb = lcm_cbrt(sb);
-          ScalarT sb2 = sb * sb;
-          ScalarT cube_root_sb2 = lcm_cbrt(sb2);
-
-          // calculate tangent
-          tangent(0, 0) = 1.0
-              + 2.0 * dt * d * (32.0 * n1 * pi * he_radius_ + cube_root_6 *
-                  cube_root_nb2 * cube_root_pi2 * cube_root_sb);
-          tangent(0, 1) = 4.0 * cube_root_2 * dt * d * n1 * cube_root_pi2 *
-              cube_root_sb / cube_root_9 / cube_root_nb;
-          tangent(0, 2) = 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 *
-              cube_root_pi2_9 / cube_root_sb2;
-          tangent(1, 0) = -32.0 * dt * d * n1 * pi * he_radius_;
-          tangent(1, 1) = 1.0;
-          tangent(1, 2) = 0.0;
-          tangent(2, 0) = -2.0 * dt * d * atomic_omega
-              * (32.0 * n1 * pi * he_radius_ + cube_root_6 *
-                  cube_root_nb2 * cube_root_pi2 * cube_root_sb) / eta_;
-          tangent(2, 1) = -4.0 * cube_root_2 * dt * d * n1 * atomic_omega *
-              cube_root_pi2 * cube_root_sb / cube_root_9 / eta_ / cube_root_nb;
-          tangent(2, 2) = 1.0
-              - 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 *
-                  atomic_omega * cube_root_pi2_9 / eta_ / cube_root_sb2;
-
-          // find increment
-          increment = -minitensor::inverse(tangent) * residual;
-
-          // update quantities
-          n1 = n1 + increment(0);
-          nb = nb + increment(1);
-          sb = sb + increment(2);
-
-          nb2 = nb * nb;
-          cube_root_nb2 = lcm_cbrt(nb2);
-          cube_root_sb = lcm_cbrt(sb);
-
-          // find new residual and norm
-          residual(0) = n1 - n1_old
-              - dt * (g - 32. * pi * he_radius_ * d * n1 * n1 -
-                  4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-          residual(1) = nb - nb_old
-              - dt * (16.0 * pi * he_radius_ * d * n1 * n1);
-          residual(2) = sb - sb_old
-              - atomic_omega / eta_ * dt
-                  * (32. * pi * he_radius_ * d * n1 * n1
-                      +
-                      4.0 * pi * d * n1 * cub_tfpi * cube_root_sb
-                          * cube_root_nb2);
-          norm_residual_2 = minitensor::norm_square(residual);
-          iter++;
-        }
+        // N-R solve for implicit time integration
+        // The states differ by many orders of magnitude (number densities
+        // vs. a volume fraction), so convergence is judged on the relative
+        // residual only. The default absolute tolerance of the minimizer
+        // would stop on the first iteration when the concentrations are small.
+        MIN minimizer;
+        minimizer.rel_tol = tolerance;
+        minimizer.abs_tol = 0.0;
+        minimizer.max_num_iter = maxIterations;
+
+        STEP step;
+        NLS he_nls(he_radius_, atomic_omega, eta_, n1_old, nb_old, sb_old,
+            d, g, dt);
+
+        minitensor::Vector<ScalarT, nls_dim> x;
+
+        x(0) = n1_0;
+        x(1) = nb_0;
+        x(2) = sb_0;
+
+        LCM::MiniSolver<MIN, STEP, NLS, EvalT, nls_dim> mini_solver(
+            minimizer, step, he_nls, x);
+
+        TEUCHOS_TEST_FOR_EXCEPTION(minimizer.failed == true, std::runtime_error,
+            "HeliumODEs: local Newton solve failed at cell " << cell
+            << ", point " << pt << ": " << minimizer.failure_message << '\n');
+
+        n1 = x(0);
+        nb = x(1);
+        sb = x(2);
       }
 
       // Update global fields
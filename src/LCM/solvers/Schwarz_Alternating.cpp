@@ -10,6 +10,7 @@
 #include "Piro_LOCASolver.hpp"
 #include "Piro_TempusSolver.hpp"
 #include "Schwarz_Alternating.hpp"
+#include "Teuchos_SerialDenseSolver.hpp"
 
 //#define DEBUG
 
@@ -49,6 +50,9 @@ SchwarzAlternating(
   reduction_factor_ = alt_system_params.get<ST>("Reduction Factor", 1.0);
   increase_factor_ = alt_system_params.get<ST>("Increase Factor", 1.0);
   output_interval_ = alt_system_params.get<int>("Exodus Write Interval", 1);
+  acceleration_ = alt_system_params.get<std::string>("Acceleration", "None");
+  relaxation_ = alt_system_params.get<ST>("Relaxation Parameter", 1.0);
+  anderson_depth_ = alt_system_params.get<int>("Anderson Depth", 5);
 
   // Firewalls
   ALBANY_ASSERT(min_iters_ >= 1);
@@ -66,6 +70,12 @@ SchwarzAlternating(
   ALBANY_ASSERT(reduction_factor_ > 0.0);
   ALBANY_ASSERT(increase_factor_ >= 1.0);
   ALBANY_ASSERT(output_interval_ >= 1);
+  ALBANY_ASSERT(
+      acceleration_ == "None" || acceleration_ == "Aitken" ||
+      acceleration_ == "Anderson",
+      "Unknown Schwarz acceleration: " << acceleration_);
+  ALBANY_ASSERT(relaxation_ > 0.0);
+  ALBANY_ASSERT(anderson_depth_ >= 1);
 
   //number of models
   num_subdomains_ = model_filenames.size();
@@ -96,6 +106,8 @@ SchwarzAlternating(
   curr_disp_.resize(num_subdomains_);
   prev_step_disp_.resize(num_subdomains_);
   internal_states_.resize(num_subdomains_);
+  prev_fixed_point_.resize(num_subdomains_);
+  prev_resid_.resize(num_subdomains_);
   //the following 9 arrays are for dynamics
   ics_disp_.resize(num_subdomains_);
   ics_velo_.resize(num_subdomains_);
@@ -218,6 +230,10 @@ SchwarzAlternating(
     curr_disp_[subdomain] = Teuchos::null;
   }
 
+  ALBANY_ASSERT(
+      is_dynamic_ == false || acceleration_ == "None",
+      "Schwarz acceleration is only implemented for quasistatics");
+
   //
   // Parameters
   //
@@ -729,6 +745,203 @@ updateConvergenceCriterion() const
   return;
 }
 
+//
+// Dot product of iterates stacked over all subdomains.
+//
+ST
+SchwarzAlternating::
+stackedDot(
+    std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>> const & a,
+    std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>> const & b) const
+{
+  ST
+  dot{0.0};
+
+  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    dot += Thyra::dot(*a[subdomain], *b[subdomain]);
+  }
+
+  return dot;
+}
+
+//
+// Forget the acceleration history. Each load step is a new fixed point
+// problem.
+//
+void
+SchwarzAlternating::
+resetAcceleration() const
+{
+  aitken_omega_ = relaxation_;
+
+  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    prev_fixed_point_[subdomain] = Teuchos::null;
+    prev_resid_[subdomain] = Teuchos::null;
+  }
+
+  delta_fixed_point_.clear();
+  delta_resid_.clear();
+
+  return;
+}
+
+//
+// Replace the iterates X_k of the last Schwarz sweep by an Aitken
+// relaxed or Anderson accelerated combination of the fixed point map
+// values G(X_k) in curr_disp_. The result is also set as the solution of
+// each application so that the Schwarz BCs of the next sweep use it.
+//
+void
+SchwarzAlternating::
+accelerateIterates(
+    std::vector<Teuchos::RCP<Thyra::VectorBase<ST> const>> const &
+    prev_disp) const
+{
+  if (acceleration_ == "None") return;
+
+  using VectorRCP = Teuchos::RCP<Thyra::VectorBase<ST>>;
+
+  bool const
+  have_prev = prev_resid_[0].is_null() == false;
+
+  // Residual of the fixed point map r_k = G(X_k) - X_k and its change.
+  std::vector<VectorRCP>
+  resid(num_subdomains_);
+
+  std::vector<VectorRCP>
+  delta_resid(num_subdomains_);
+
+  std::vector<VectorRCP>
+  delta_fixed_point(num_subdomains_);
+
+  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    auto const &
+    fixed_point = *curr_disp_[subdomain];
+
+    resid[subdomain] = fixed_point.clone_v();
+    Thyra::Vp_StV(resid[subdomain].ptr(), -1.0, *prev_disp[subdomain]);
+
+    if (have_prev == true) {
+      delta_resid[subdomain] = resid[subdomain]->clone_v();
+      Thyra::Vp_StV(
+          delta_resid[subdomain].ptr(), -1.0, *prev_resid_[subdomain]);
+
+      delta_fixed_point[subdomain] = fixed_point.clone_v();
+      Thyra::Vp_StV(
+          delta_fixed_point[subdomain].ptr(),
+          -1.0,
+          *prev_fixed_point_[subdomain]);
+    }
+  }
+
+  std::vector<VectorRCP>
+  next_disp(num_subdomains_);
+
+  if (acceleration_ == "Aitken") {
+    if (have_prev == true) {
+      ST const
+      dr_dr = stackedDot(delta_resid, delta_resid);
+
+      if (dr_dr > 0.0) {
+        aitken_omega_ *= -stackedDot(prev_resid_, delta_resid) / dr_dr;
+      }
+    }
+
+    // X_k+1 = X_k + omega r_k
+    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      next_disp[subdomain] = prev_disp[subdomain]->clone_v();
+      Thyra::Vp_StV(
+          next_disp[subdomain].ptr(), aitken_omega_, *resid[subdomain]);
+    }
+  }
+
+  if (acceleration_ == "Anderson") {
+    if (have_prev == true) {
+      delta_resid_.push_back(delta_resid);
+      delta_fixed_point_.push_back(delta_fixed_point);
+      if (static_cast<int>(delta_resid_.size()) > anderson_depth_) {
+        delta_resid_.pop_front();
+        delta_fixed_point_.pop_front();
+      }
+    }
+
+    int const
+    depth = delta_resid_.size();
+
+    // Least squares min |r_k - dR gamma| through the normal equations.
+    Teuchos::SerialDenseVector<int, ST>
+    gamma(depth);
+
+    bool
+    solved{false};
+
+    if (depth > 0) {
+      Teuchos::SerialDenseMatrix<int, ST>
+      gram(depth, depth);
+
+      Teuchos::SerialDenseVector<int, ST>
+      rhs(depth);
+
+      for (auto i = 0; i < depth; ++i) {
+        rhs(i) = stackedDot(delta_resid_[i], resid);
+        for (auto j = 0; j <= i; ++j) {
+          gram(i, j) = stackedDot(delta_resid_[i], delta_resid_[j]);
+          gram(j, i) = gram(i, j);
+        }
+      }
+
+      Teuchos::SerialDenseSolver<int, ST>
+      solver;
+
+      solver.setMatrix(Teuchos::rcpFromRef(gram));
+      solver.setVectors(Teuchos::rcpFromRef(gamma), Teuchos::rcpFromRef(rhs));
+      solver.factorWithEquilibration(true);
+      solved = solver.solve() == 0;
+    }
+
+    // Rank deficient history. Start over with plain relaxation.
+    if (solved == false) {
+      delta_resid_.clear();
+      delta_fixed_point_.clear();
+    }
+
+    // X_k+1 = G(X_k) - dG gamma - (1 - beta) (r_k - dR gamma)
+    ST const
+    beta = relaxation_;
+
+    for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+      next_disp[subdomain] = curr_disp_[subdomain]->clone_v();
+      Thyra::Vp_StV(
+          next_disp[subdomain].ptr(), beta - 1.0, *resid[subdomain]);
+      if (solved == true) {
+        for (auto i = 0; i < depth; ++i) {
+          Thyra::Vp_StV(
+              next_disp[subdomain].ptr(),
+              -gamma(i),
+              *delta_fixed_point_[i][subdomain]);
+          Thyra::Vp_StV(
+              next_disp[subdomain].ptr(),
+              (1.0 - beta) * gamma(i),
+              *delta_resid_[i][subdomain]);
+        }
+      }
+    }
+  }
+
+  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    prev_fixed_point_[subdomain] = curr_disp_[subdomain];
+    prev_resid_[subdomain] = resid[subdomain];
+    curr_disp_[subdomain] = next_disp[subdomain];
+
+    Teuchos::RCP<Thyra::VectorBase<ST> const>
+    next = next_disp[subdomain];
+
+    apps_[subdomain]->setX(ConverterT::getConstTpetraVector(next));
+  }
+
+  return;
+}
+
 //
 //
 //
@@ -1480,6 +1693,12 @@ SchwarzLoopQuasistatics() const
 
     num_iter_ = 0;
 
+    resetAcceleration();
+
+    // Iterates at the start of each Schwarz sweep, for acceleration.
+    std::vector<Teuchos::RCP<Thyra::VectorBase<ST> const>>
+    sweep_disp(num_subdomains_);
+
     // Schwarz loop
     do {
 
@@ -1502,6 +1721,8 @@ SchwarzLoopQuasistatics() const
         auto
         prev_disp_rcp = curr_disp_[subdomain];
 
+        sweep_disp[subdomain] = prev_disp_rcp;
+
         auto const &
         prev_disp = *prev_disp_rcp;
 
@@ -1642,6 +1863,9 @@ SchwarzLoopQuasistatics() const
       fos << "Relative tolerance :" << rel_tol_ << '\n';
       fos << delim << std::endl;
 
+      // Leave converged iterates alone, they satisfy the subdomain problems.
+      if (converged_ == false) accelerateIterates(sweep_disp);
+
     }  while (continueSolve() == true); // Schwarz loop
 
     // One or more of the subdomains failed to solve. Reduce step.
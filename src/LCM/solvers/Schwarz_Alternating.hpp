@@ -7,6 +7,7 @@
 #if !defined(LCM_SchwarzAlternating_hpp)
 #define LCM_SchwarzAlternating_hpp
 
+#include <deque>
 #include <functional>
 
 #include "Albany_AbstractSTKMeshStruct.hpp"
@@ -147,6 +148,19 @@ private:
   void
   updateConvergenceCriterion() const;
 
+  void
+  resetAcceleration() const;
+
+  void
+  accelerateIterates(
+      std::vector<Teuchos::RCP<Thyra::VectorBase<ST> const>> const &
+      prev_disp) const;
+
+  ST
+  stackedDot(
+      std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>> const & a,
+      std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>> const & b) const;
+
   bool
   continueSolve() const;
 
@@ -216,6 +230,16 @@ private:
   int
   output_interval_{1};
 
+  // Acceleration of the Schwarz iterates: None, Aitken or Anderson
+  std::string
+  acceleration_{"None"};
+
+  ST
+  relaxation_{1.0};
+
+  int
+  anderson_depth_{5};
+
   mutable bool
   failed_{false};
 
@@ -285,6 +309,24 @@ private:
   mutable std::vector<LCM::StateArrays>
   internal_states_;
 
+  // Acceleration history. Only displacement vectors are kept: the fixed
+  // point map value and residual of the last iteration, and for Anderson
+  // the differences of the last anderson_depth_ iterations.
+  mutable ST
+  aitken_omega_{1.0};
+
+  mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST> const>>
+  prev_fixed_point_;
+
+  mutable std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>
+  prev_resid_;
+
+  mutable std::deque<std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>>
+  delta_fixed_point_;
+
+  mutable std::deque<std::vector<Teuchos::RCP<Thyra::VectorBase<ST>>>>
+  delta_resid_;
+
   mutable std::vector<bool> 
   do_outputs_; 
   
@@ -0,0 +1,416 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <cmath>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_SaveStateField.hpp"
+#include "Albany_StateManager.hpp"
+#include "Albany_TmplSTKMeshStruct.hpp"
+#include "Albany_STKDiscretization.hpp"
+#include "Albany_Utils.hpp"
+#include "Albany_Layouts.hpp"
+#include "SetField.hpp"
+#include "ACEdensity.hpp"
+#include "ACEfreezingCurve.hpp"
+#include "ACEheatCapacity.hpp"
+#include "ACEiceSaturation.hpp"
+#include "ACEmeltingTemperature.hpp"
+#include "ACEporosity.hpp"
+#include "ACEtemperatureChange.hpp"
+#include "ACEthermalConductivity.hpp"
+#include "ACEthermalInertia.hpp"
+#include "ACEthermalProperties.hpp"
+#include "ACEwaterSaturation.hpp"
+
+//
+// Run the fused ACE thermal properties evaluator and the chain of individual
+// ACE evaluators over a cooling and warming cycle through the phase change
+// range, with the old temperature and ice saturation kept as states, and
+// check that both give the same, finite, thermal conductivity, thermal
+// inertia and ice saturation at every step, including steps without a
+// temperature change.
+//
+namespace
+{
+
+typedef PHX::MDField<PHAL::AlbanyTraits::Residual::ScalarT>::size_type size_type;
+typedef PHAL::AlbanyTraits::Residual Residual;
+typedef PHAL::AlbanyTraits::Residual::ScalarT ScalarT;
+typedef PHAL::AlbanyTraits Traits;
+using Teuchos::RCP;
+using Teuchos::rcp;
+using Teuchos::ArrayRCP;
+
+const int workset_size = 1;
+const int num_pts = 1;
+const int num_dims = 3;
+const int num_vertices = 8;
+const int num_nodes = 8;
+
+// Temperatures of the successive steps. The temperature does not change in
+// the first step (melted), at -0.2 (in the phase change range) and at -0.7
+// (frozen), as at the start of a Newton solve from the last converged step.
+const double temperature_init = 0.6;
+const double temperatures[] = {0.6, 0.4, 0.2, 0.1, -0.05, -0.2, -0.2, -0.45,
+                               -0.7, -0.7, -0.3, -0.1, 0.05, 0.25, 0.5};
+const int num_steps = sizeof(temperatures) / sizeof(temperatures[0]);
+
+void
+setMaterial(Teuchos::ParameterList& ace)
+{
+  Teuchos::ParameterList& density = ace.sublist("ACE Density");
+  density.set<double>("Ice Value", 920.0);
+  density.set<double>("Water Value", 1000.0);
+  density.set<double>("Sediment Value", 2650.0);
+
+  Teuchos::ParameterList& heat_capacity = ace.sublist("ACE Heat Capacity");
+  heat_capacity.set<double>("Ice Value", 2090.0);
+  heat_capacity.set<double>("Water Value", 4186.0);
+  heat_capacity.set<double>("Sediment Value", 800.0);
+
+  Teuchos::ParameterList& conductivity =
+      ace.sublist("ACE Thermal Conductivity");
+  conductivity.set<double>("Ice Value", 2.22);
+  conductivity.set<double>("Water Value", 0.6);
+  conductivity.set<double>("Sediment Value", 2.5);
+
+  Teuchos::ParameterList& inertia = ace.sublist("ACE Thermal Inertia");
+  inertia.set<double>("ACE Latent Heat of Phase Change", 334.0);
+  inertia.set<double>("ACE Ice Density", 920.0);
+
+  Teuchos::ParameterList& porosity = ace.sublist("ACE Porosity");
+  porosity.set<std::string>("Porosity Type", "Constant");
+  porosity.set<double>("Value", 0.4);
+
+  Teuchos::ParameterList& freezing_curve = ace.sublist("ACE Freezing Curve");
+  freezing_curve.set<double>("Phase Change Temperature Range", 1.0);
+
+  Teuchos::ParameterList& ice_saturation = ace.sublist("ACE Ice Saturation");
+  ice_saturation.set<double>("Initial Ice Saturation", 0.0);
+  ice_saturation.set<double>("Maximum Ice Saturation", 0.95);
+
+  Teuchos::ParameterList& water_saturation =
+      ace.sublist("ACE Water Saturation");
+  water_saturation.set<double>("Minimum Water Saturation", 0.05);
+}
+
+// Evaluate the ACE thermal properties at every step and record the thermal
+// conductivity, thermal inertia and ice saturation.
+void
+runACE(bool fused, std::vector<double>& history)
+{
+  Teuchos::RCP<const Teuchos_Comm> commT =
+    Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
+
+  std::string element_block_name = "Block0";
+
+  const RCP<Albany::Layouts> dl =
+      rcp(new Albany::Layouts(workset_size, num_vertices,
+          num_nodes, num_pts, num_dims));
+
+  Teuchos::ParameterList ace;
+  setMaterial(ace);
+
+  //--------------------------------------------------------------------------
+  // temperature, pressure and salinity
+  ArrayRCP<ScalarT> temperature(1);
+  temperature[0] = temperature_init;
+
+  Teuchos::ParameterList tPL;
+  tPL.set<std::string>("Evaluated Field Name", "Temperature");
+  tPL.set<ArrayRCP<ScalarT>>("Field Values", temperature);
+  tPL.set<RCP<PHX::DataLayout>>("Evaluated Field Data Layout",
+      dl->qp_scalar);
+  RCP<LCM::SetField<Residual, Traits>> setFieldTemperature =
+      rcp(new LCM::SetField<Residual, Traits>(tPL));
+
+  ArrayRCP<ScalarT> pressure(1);
+  pressure[0] = 1.0e5;
+
+  Teuchos::ParameterList pPL;
+  pPL.set<std::string>("Evaluated Field Name", "ACE Pressure");
+  pPL.set<ArrayRCP<ScalarT>>("Field Values", pressure);
+  pPL.set<RCP<PHX::DataLayout>>("Evaluated Field Data Layout",
+      dl->qp_scalar);
+  RCP<LCM::SetField<Residual, Traits>> setFieldPressure =
+      rcp(new LCM::SetField<Residual, Traits>(pPL));
+
+  ArrayRCP<ScalarT> salinity(1);
+  salinity[0] = 0.1;
+
+  Teuchos::ParameterList sPL;
+  sPL.set<std::string>("Evaluated Field Name", "ACE Salinity");
+  sPL.set<ArrayRCP<ScalarT>>("Field Values", salinity);
+  sPL.set<RCP<PHX::DataLayout>>("Evaluated Field Data Layout",
+      dl->qp_scalar);
+  RCP<LCM::SetField<Residual, Traits>> setFieldSalinity =
+      rcp(new LCM::SetField<Residual, Traits>(sPL));
+
+  //--------------------------------------------------------------------------
+  // ACE evaluators
+  Teuchos::ParameterList acePL;
+  acePL.set<std::string>("Temperature Name", "Temperature");
+  acePL.set<std::string>("ACE Pressure", "ACE Pressure");
+  acePL.set<std::string>("ACE Salinity", "ACE Salinity");
+  acePL.set<std::string>("ACE Melting Temperature", "ACE Melting Temperature");
+  acePL.set<std::string>("ACE Temperature Change", "ACE Temperature Change");
+  acePL.set<std::string>(
+      "ACE Evaluated Ice Saturation", "ACE Evaluated Ice Saturation");
+  acePL.set<std::string>("ACE Freezing Curve Slope", "ACE Freezing Curve Slope");
+  acePL.set<std::string>("ACE Ice Saturation", "ACE Ice Saturation");
+  acePL.set<std::string>("ACE Water Saturation", "ACE Water Saturation");
+  acePL.set<std::string>("ACE Porosity", "ACE Porosity");
+  acePL.set<std::string>("ACE Density", "ACE Density");
+  acePL.set<std::string>("ACE Heat Capacity", "ACE Heat Capacity");
+  acePL.set<std::string>(
+      "ACE Thermal Conductivity", "ACE Thermal Conductivity");
+  acePL.set<std::string>("ACE Thermal Inertia", "ACE Thermal Inertia");
+  acePL.set<RCP<PHX::DataLayout>>("QP Scalar Data Layout", dl->qp_scalar);
+  acePL.set<RCP<PHX::DataLayout>>("QP Vector Data Layout", dl->qp_vector);
+
+  std::vector<RCP<PHX::Evaluator<Traits>>> ace_evaluators;
+
+  if (fused == true) {
+    acePL.set<Teuchos::ParameterList*>("Parameter List", &ace);
+    ace_evaluators.push_back(
+        rcp(new LCM::ACEthermalProperties<Residual, Traits>(acePL, dl)));
+  } else {
+    acePL.set<Teuchos::ParameterList*>("Parameter List", &ace);
+    ace_evaluators.push_back(
+        rcp(new LCM::ACEmeltingTemperature<Residual, Traits>(acePL, dl)));
+    ace_evaluators.push_back(
+        rcp(new LCM::ACEtemperatureChange<Residual, Traits>(acePL, dl)));
+
+    acePL.set<Teuchos::ParameterList*>(
+        "Parameter List", &ace.sublist("ACE Freezing Curve"));
+    ace_evaluators.push_back(
+        rcp(new LCM::ACEfreezingCurve<Residual, Traits>(acePL, dl)));
+
+    acePL.set<Teuchos::ParameterList*>(
+        "Parameter List", &ace.sublist("ACE Ice Saturation"));
+    ace_evaluators.push_back(
+        rcp(new LCM::ACEiceSaturation<Residual, Traits>(acePL, dl)));
+
+    acePL.set<Teuchos::ParameterList*>(
+        "Parameter List", &ace.sublist("ACE Water Saturation"));
+    ace_evaluators.push_back(
+        rcp(new LCM::ACEwaterSaturation<Residual, Traits>(acePL, dl)));
+
+    acePL.set<Teuchos::ParameterList*>(
+        "Parameter List", &ace.sublist("ACE Porosity"));
+    ace_evaluators.push_back(
+        rcp(new LCM::ACEporosity<Residual, Traits>(acePL)));
+
+    acePL.set<Teuchos::ParameterList*>(
+        "Parameter List", &ace.sublist("ACE Density"));
+    ace_evaluators.push_back(
+        rcp(new LCM::ACEdensity<Residual, Traits>(acePL, dl)));
+
+    acePL.set<Teuchos::ParameterList*>(
+        "Parameter List", &ace.sublist("ACE Heat Capacity"));
+    ace_evaluators.push_back(
+        rcp(new LCM::ACEheatCapacity<Residual, Traits>(acePL, dl)));
+
+    acePL.set<Teuchos::ParameterList*>(
+        "Parameter List", &ace.sublist("ACE Thermal Conductivity"));
+    ace_evaluators.push_back(
+        rcp(new LCM::ACEthermalConductivity<Residual, Traits>(acePL, dl)));
+
+    acePL.set<Teuchos::ParameterList*>(
+        "Parameter List", &ace.sublist("ACE Thermal Inertia"));
+    ace_evaluators.push_back(
+        rcp(new LCM::ACEthermalInertia<Residual, Traits>(acePL, dl)));
+  }
+
+  //--------------------------------------------------------------------------
+  // Instantiate a field manager.
+  PHX::FieldManager<Traits> field_manager;
+
+  // Instantiate a field manager for States
+  PHX::FieldManager<Traits> state_field_manager;
+
+  field_manager.registerEvaluator<Residual>(setFieldTemperature);
+  field_manager.registerEvaluator<Residual>(setFieldPressure);
+  field_manager.registerEvaluator<Residual>(setFieldSalinity);
+  state_field_manager.registerEvaluator<Residual>(setFieldTemperature);
+  state_field_manager.registerEvaluator<Residual>(setFieldPressure);
+  state_field_manager.registerEvaluator<Residual>(setFieldSalinity);
+
+  for (auto ev : ace_evaluators) {
+    field_manager.registerEvaluator<Residual>(ev);
+    state_field_manager.registerEvaluator<Residual>(ev);
+  }
+
+  PHX::MDField<ScalarT, Cell, QuadPoint> thermal_conductivity(
+      "ACE Thermal Conductivity", dl->qp_scalar);
+  PHX::MDField<ScalarT, Cell, QuadPoint> thermal_inertia(
+      "ACE Thermal Inertia", dl->qp_scalar);
+  PHX::MDField<ScalarT, Cell, QuadPoint> ice_saturation(
+      "ACE Ice Saturation", dl->qp_scalar);
+
+  field_manager.requireField<Residual>(thermal_conductivity.fieldTag());
+  field_manager.requireField<Residual>(thermal_inertia.fieldTag());
+  field_manager.requireField<Residual>(ice_saturation.fieldTag());
+
+  //--------------------------------------------------------------------------
+  // Instantiate a state manager
+  Albany::StateManager stateMgr;
+
+  // register the states, the "_old" values are read by the ACE evaluators
+  Teuchos::RCP<Teuchos::ParameterList> p;
+  Teuchos::RCP<PHX::Evaluator<Traits>> ev;
+  p = stateMgr.registerStateVariable("Temperature",
+                          dl->qp_scalar,
+                          dl->dummy,
+                          element_block_name,
+                          "scalar",
+                          temperature_init,
+                          true,   //state
+                          false); //output
+  ev = Teuchos::rcp(new PHAL::SaveStateField<Residual, Traits>(*p));
+  field_manager.registerEvaluator<Residual>(ev);
+  state_field_manager.registerEvaluator<Residual>(ev);
+
+  p = stateMgr.registerStateVariable("ACE Ice Saturation",
+                          dl->qp_scalar,
+                          dl->dummy,
+                          element_block_name,
+                          "scalar",
+                          ace.sublist("ACE Ice Saturation").get<double>(
+                              "Initial Ice Saturation"),
+                          true,   //state
+                          false); //output
+  ev = Teuchos::rcp(new PHAL::SaveStateField<Residual, Traits>(*p));
+  field_manager.registerEvaluator<Residual>(ev);
+  state_field_manager.registerEvaluator<Residual>(ev);
+
+  //--------------------------------------------------------------------------
+  // Call postRegistrationSetup on the evaluators
+  PHAL::AlbanyTraits::SetupData setupData = "Test String";
+  field_manager.postRegistrationSetup(setupData);
+
+  Teuchos::RCP<PHX::DataLayout> dummy = Teuchos::rcp(
+      new PHX::MDALayout<Dummy>(0));
+  std::vector<std::string> responseIDs =
+    stateMgr.getResidResponseIDsToRequire(element_block_name);
+  std::vector<std::string>::const_iterator it;
+  for (it = responseIDs.begin(); it != responseIDs.end(); it++) {
+    const std::string& responseID = *it;
+    PHX::Tag<PHAL::AlbanyTraits::Residual::ScalarT> res_response_tag(
+        responseID,
+        dummy);
+    state_field_manager.requireField<PHAL::AlbanyTraits::Residual>(
+        res_response_tag);
+  }
+  state_field_manager.postRegistrationSetup("");
+
+  //---------------------------------------------------------------------------
+  // Create discretization, as required by the StateManager
+  //
+  Teuchos::RCP<Teuchos::ParameterList> discretizationParameterList =
+      Teuchos::rcp(new Teuchos::ParameterList("Discretization"));
+  discretizationParameterList->set<int>("1D Elements", workset_size);
+  discretizationParameterList->set<int>("2D Elements", 1);
+  discretizationParameterList->set<int>("3D Elements", 1);
+  discretizationParameterList->set<std::string>("Method", "STK3D");
+  discretizationParameterList->set<int>("Number Of Time Derivatives", 0);
+  discretizationParameterList->set<std::string>(
+      "Exodus Output File Name",
+      fused == true ? "ace_fused.exo" : "ace_chain.exo");
+
+  int numberOfEquations = 3;
+  Albany::AbstractFieldContainer::FieldContainerRequirements req;
+
+  Teuchos::RCP<Albany::AbstractSTKMeshStruct> stkMeshStruct = Teuchos::rcp(
+      new Albany::TmplSTKMeshStruct<3>(
+          discretizationParameterList,
+          Teuchos::null,
+          commT));
+  stkMeshStruct->setFieldAndBulkData(
+      commT,
+      discretizationParameterList,
+      numberOfEquations,
+      req,
+      stateMgr.getStateInfoStruct(),
+      stkMeshStruct->getMeshSpecs()[0]->worksetSize);
+
+  Teuchos::RCP<Albany::AbstractDiscretization> discretization = Teuchos::rcp(
+      new Albany::STKDiscretization( discretizationParameterList, stkMeshStruct, commT));
+
+  //---------------------------------------------------------------------------
+  // Associate the discretization with the StateManager
+  //
+  stateMgr.setupStateArrays(discretization);
+
+  //--------------------------------------------------------------------------
+  // Create a workset
+  PHAL::Workset workset;
+  workset.numCells = workset_size;
+  workset.stateArrayPtr = &stateMgr.getStateArray(
+      Albany::StateManager::ELEM,
+      0);
+
+  //--------------------------------------------------------------------------
+  // loop over the steps, accepting each one
+  for (int step = 0; step < num_steps; ++step) {
+
+    temperature[0] = temperatures[step];
+
+    field_manager.preEvaluate<Residual>(workset);
+    field_manager.evaluateFields<Residual>(workset);
+    field_manager.postEvaluate<Residual>(workset);
+
+    field_manager.getFieldData<Residual>(thermal_conductivity);
+    field_manager.getFieldData<Residual>(thermal_inertia);
+    field_manager.getFieldData<Residual>(ice_saturation);
+
+    for (size_type cell = 0; cell < workset_size; ++cell) {
+      for (size_type pt = 0; pt < num_pts; ++pt) {
+        history.push_back(thermal_conductivity(cell, pt));
+        history.push_back(thermal_inertia(cell, pt));
+        history.push_back(ice_saturation(cell, pt));
+      }
+    }
+
+    state_field_manager.preEvaluate<Residual>(workset);
+    state_field_manager.evaluateFields<Residual>(workset);
+    state_field_manager.postEvaluate<Residual>(workset);
+
+    stateMgr.updateStates();
+  }
+}
+
+TEUCHOS_UNIT_TEST(ACEthermalProperties, FusedMatchesChain)
+{
+  // A mpi object must be instantiated
+  Teuchos::GlobalMPISession mpi_session(void);
+
+  std::vector<double> fused, chain;
+  runACE(true, fused);
+  runACE(false, chain);
+
+  TEST_EQUALITY(fused.size(), chain.size());
+  TEST_EQUALITY(fused.size(),
+                static_cast<std::size_t>(3 * num_steps * workset_size * num_pts));
+
+  for (std::size_t i = 0; i < fused.size() && i < chain.size(); ++i) {
+    TEST_ASSERT(std::isfinite(fused[i]));
+    TEST_ASSERT(std::isfinite(chain[i]));
+    TEST_FLOATING_EQUALITY(fused[i], chain[i], 1.0e-12);
+  }
+
+  // The ice saturation must have left zero on the way down
+  bool froze = false;
+  for (std::size_t i = 2; i < fused.size(); i += 3)
+    if (fused[i] > 0.0) froze = true;
+  TEST_ASSERT(froze);
+}
+
+} // namespace
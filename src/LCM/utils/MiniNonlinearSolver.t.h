@@ -137,6 +137,42 @@ MiniSolver(
     FN & function,
     minitensor::Vector<PHAL::AlbanyTraits::DistParamDeriv::ScalarT, N> & soln)
 {
+  // Make sure that if Albany is compiled with a static FAD type
+  // there won't be confusion with MiniSolver's FAD.
+  using AD = minitensor::FAD<RealType, N>;
+
+  using T = PHAL::AlbanyTraits::DistParamDeriv::ScalarT;
+
+  static_assert(
+      std::is_same<T, AD>::value == false,
+      "Albany and MiniSolver Fad types not allowed to be equal.");
+
+  using ValueT = typename Sacado::ValueType<T>::type;
+
+  minitensor::Vector<ValueT, N>
+  soln_val = Sacado::Value<minitensor::Vector<T, N>>::eval(soln);
+
+  minimizer.solve(step_method, function, soln_val);
+
+  auto const
+  dimension = soln.get_dimension();
+
+  // Put values back in solution vector
+  for (auto i = 0; i < dimension; ++i) {
+    soln(i).val() = soln_val(i);
+  }
+
+  // Get the Hessian evaluated at the solution.
+  minitensor::Tensor<ValueT, N>
+  DrDx = function.hessian(soln_val);
+
+  // Now compute gradient with solution that has Albany sensitivities.
+  minitensor::Vector<T, N>
+  resi = function.gradient(soln);
+
+  // Solve for solution sensitivities.
+  computeFADInfo(resi, DrDx, soln);
+
   return;
 }
 
@@ -1099,51 +1099,84 @@ void LCM::PeridigmManager::writePeridigmSubModel(RealType currentTime)
     peridigm->writePeridigmSubModel(currentTime);
 }
 
+void LCM::PeridigmManager::computePeridigmToAlbanyJacobianOffsets(Teuchos::RCP<const Tpetra_CrsMatrix> jacT,
+                                                                   const Epetra_FECrsMatrix& peridigmTangent)
+{
+  Tpetra_CrsMatrix::local_matrix_type albanyJacobian = jacT->getLocalMatrix();
+
+  peridigmToAlbanyJacobianOffsets.resize(peridigmTangent.NumMyNonzeros());
+  std::size_t entry = 0;
+
+  for(int peridigmLocalRow=0 ; peridigmLocalRow<peridigmTangent.NumMyRows() ; peridigmLocalRow++){
+
+    int globalRow = peridigmTangent.RowMatrixRowMap().GID(peridigmLocalRow);
+    LO albanyLocalRow = jacT->getRowMap()->getLocalElement(globalRow);
+    TEUCHOS_TEST_FOR_EXCEPTION(albanyLocalRow == Teuchos::OrdinalTraits<LO>::invalid(), std::logic_error, "Error copying Peridigm Jacobian values into Albany Jacobian.\n");
+
+    std::size_t const albanyRowBegin = albanyJacobian.graph.row_map(albanyLocalRow);
+    std::size_t const albanyRowEnd = albanyJacobian.graph.row_map(albanyLocalRow + 1);
+
+    int peridigmNumEntries;
+    double* peridigmValues;
+    int* peridigmLocalColIndices;
+    peridigmTangent.ExtractMyRowView(peridigmLocalRow, peridigmNumEntries, peridigmValues, peridigmLocalColIndices);
+
+    for(int i=0 ; i<peridigmNumEntries ; i++){
+      int globalCol = peridigmTangent.ColMap().GID(peridigmLocalColIndices[i]);
+      LO albanyLocalCol = jacT->getColMap()->getLocalElement( static_cast<GO>(globalCol) );
+      std::size_t offset = albanyRowBegin;
+      while(offset < albanyRowEnd && albanyJacobian.graph.entries(offset) != albanyLocalCol)
+        offset++;
+      TEUCHOS_TEST_FOR_EXCEPTION(offset == albanyRowEnd, std::logic_error, "Error copying Peridigm Jacobian values into Albany Jacobian.\n");
+      peridigmToAlbanyJacobianOffsets[entry++] = offset;
+    }
+  }
+
+  albanyJacobianGraph = jacT->getCrsGraph();
+}
+
 bool LCM::PeridigmManager::copyPeridigmTangentStiffnessMatrixIntoAlbanyJacobian(Teuchos::RCP<Tpetra_CrsMatrix> jacT)
 {
   if(!peridigm->hasTangentStiffnessMatrix())
     return false;
 
-  jacT->globalAssemble();
   evaluateTangentStiffnessMatrix();
   Teuchos::RCP<const Epetra_FECrsMatrix> peridigmTangent = peridigm->getTangentStiffnessMatrix();
   //   char name[100];
   //   sprintf(name, "peridigmJac%i.mm", countJac);
   //   EpetraExt::RowMatrixToMatrixMarketFile(name, *peridigmTangent);
 
-  for(int peridigmLocalRow=0 ; peridigmLocalRow<peridigmTangent->NumMyRows() ; peridigmLocalRow++){
-
-    int globalRow = peridigmTangent->RowMatrixRowMap().GID(peridigmLocalRow);
+  // The values are written through getLocalMatrix(), in the same storage
+  // that sumIntoLocalValues() uses. This needs a matrix built on the fixed
+  // Albany Jacobian graph, whose local matrix exists from construction, and
+  // an active fill, i.e., a call between resumeFill() and fillComplete() of
+  // the Jacobian assembly. Both hold on every rank or on none, so no rank
+  // changes the fill state of the matrix here.
+  TEUCHOS_TEST_FOR_EXCEPTION(!jacT->isStaticGraph(), std::logic_error,
+                             "Error copying Peridigm Jacobian values into Albany Jacobian: the Jacobian must be built on the Albany Jacobian graph.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION(!jacT->isFillActive(), std::logic_error,
+                             "Error copying Peridigm Jacobian values into Albany Jacobian: fill is not active.\n");
+
+  // The coupled graph is fixed, so the translation from Peridigm entries to
+  // Albany storage is only recomputed when the Albany graph is rebuilt.
+  if(albanyJacobianGraph.get() != jacT->getCrsGraph().get() ||
+     peridigmToAlbanyJacobianOffsets.size() != static_cast<std::size_t>(peridigmTangent->NumMyNonzeros()))
+    computePeridigmToAlbanyJacobianOffsets(jacT, *peridigmTangent);
+
+  // Scatter the values straight into the local storage of the Albany Jacobian.
+  Tpetra_CrsMatrix::local_matrix_type albanyJacobian = jacT->getLocalMatrix();
+  std::size_t entry = 0;
 
+  for(int peridigmLocalRow=0 ; peridigmLocalRow<peridigmTangent->NumMyRows() ; peridigmLocalRow++){
     int peridigmNumEntries;
     double* peridigmValues;
     int* peridigmLocalColIndices;
     peridigmTangent->ExtractMyRowView(peridigmLocalRow, peridigmNumEntries, peridigmValues, peridigmLocalColIndices);
 
-    std::vector<int> globalColIndices(peridigmNumEntries);
     for(int i=0 ; i<peridigmNumEntries ; i++){
-      globalColIndices[i] = peridigmTangent->ColMap().GID(peridigmLocalColIndices[i]);
+      albanyJacobian.values(peridigmToAlbanyJacobianOffsets[entry++]) = -1.0 * static_cast<RealType>(peridigmValues[i]);
     }
-
-    LO albanyLocalRow = jacT->getRowMap()->getLocalElement(globalRow);
-
-    std::vector<LO> albanyLocalColIndices(peridigmNumEntries);
-    for(int i=0 ; i<peridigmNumEntries ; i++){
-      albanyLocalColIndices[i] = jacT->getColMap()->getLocalElement( static_cast<GO>(globalColIndices[i]) );
-    }
-    Teuchos::ArrayView<LO> albanyLocalColIndicesView(&albanyLocalColIndices[0], peridigmNumEntries);
-
-    std::vector<RealType> albanyValues(peridigmNumEntries);
-    for(int i=0 ; i<peridigmNumEntries ; i++){
-      albanyValues[i] = -1.0 * static_cast<RealType>(peridigmValues[i]);
-    }
-    Teuchos::ArrayView<RealType> albanyValuesView(&albanyValues[0], peridigmNumEntries);
-
-    LO numReplaced = jacT->replaceLocalValues(albanyLocalRow, albanyLocalColIndicesView, albanyValuesView);
-
-    TEUCHOS_TEST_FOR_EXCEPTION(numReplaced != peridigmNumEntries, std::logic_error, "Error copying Peridigm Jacobian values into Albany Jacobian.\n");
   }
-  jacT->globalAssemble();
 
   return true;
 }
@@ -88,6 +88,7 @@ public:
   }
 
   //! Copy values from the Peridigm tangent stiffness matrix into the Albany jacobian.
+  //! The Jacobian must be built on the Albany Jacobian graph, with its fill active.
   bool copyPeridigmTangentStiffnessMatrixIntoAlbanyJacobian(Teuchos::RCP<Tpetra_CrsMatrix> jacT);
 
   //! Evaluate the peridynamic internal force
@@ -189,6 +190,16 @@ private:
 
   Teuchos::RCP<Tpetra_Vector> albanyOverlapSolutionVector;
 
+  //! Albany Jacobian graph for which peridigmToAlbanyJacobianOffsets was computed.
+  Teuchos::RCP<const Tpetra_CrsGraph> albanyJacobianGraph;
+
+  //! Offset into the local values of the Albany Jacobian for each entry of the Peridigm tangent, in Peridigm row order.
+  std::vector<std::size_t> peridigmToAlbanyJacobianOffsets;
+
+  //! Compute peridigmToAlbanyJacobianOffsets for the graph of the given Albany Jacobian.
+  void computePeridigmToAlbanyJacobianOffsets(Teuchos::RCP<const Tpetra_CrsMatrix> jacT,
+                                              const Epetra_FECrsMatrix& peridigmTangent);
+
   //! Constructor, private to prohibit use.
   PeridigmManager();
 
@@ -173,6 +173,15 @@ Topology::checkOpen(stk::mesh::Entity e)
   return fracture_criterion_->check(get_bulk_data(), e);
 }
 
+//
+// Check fracture criterion for a batch of entities
+//
+stk::mesh::EntityVector
+Topology::checkOpen(stk::mesh::EntityVector const & entities)
+{
+  return fracture_criterion_->checkAll(get_bulk_data(), entities);
+}
+
 //
 // Initialize fracture state field
 // It exists for all entities except cells (elements)
@@ -1395,10 +1404,11 @@ Topology::setEntitiesOpen()
       get_bulk_data().buckets(get_boundary_rank()),
       boundary_entities);
 
-  size_t
-  counter = 0;
+  stk::mesh::EntityVector
+  internal_entities;
+
+  internal_entities.reserve(boundary_entities.size());
 
-  // Iterate over the boundary entities
   for (EntityVectorIndex i = 0; i < boundary_entities.size(); ++i) {
 
     stk::mesh::Entity
@@ -1406,7 +1416,21 @@ Topology::setEntitiesOpen()
 
     if (is_internal(entity) == false) continue;
 
-    if (checkOpen(entity) == false) continue;
+    internal_entities.push_back(entity);
+  }
+
+  // Evaluate the fracture criterion for all candidates at once
+  stk::mesh::EntityVector const
+  open_entities = checkOpen(internal_entities);
+
+  size_t
+  counter = 0;
+
+  // Iterate over the boundary entities that open
+  for (EntityVectorIndex i = 0; i < open_entities.size(); ++i) {
+
+    stk::mesh::Entity
+    entity = open_entities[i];
 
     set_fracture_state(entity, OPEN);
     ++counter;
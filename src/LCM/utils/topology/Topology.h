@@ -542,6 +542,13 @@ public:
   bool
   checkOpen(stk::mesh::Entity e);
 
+  ///
+  /// Check fracture criterion for a batch of entities.
+  /// Returns the entities that open, in the order given.
+  ///
+  stk::mesh::EntityVector
+  checkOpen(stk::mesh::EntityVector const & entities);
+
   ///
   /// Initialization of the open field for fracture
   ///
@@ -4,6 +4,8 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <Kokkos_Core.hpp>
+
 #include "Topology.h"
 #include "Topology_FractureCriterion.h"
 
@@ -105,7 +107,7 @@ FractureCriterionTraction::check(
   stk::mesh::EntityId const
   face_id = get_bulk_data().identifier(interface);
 
-  minitensor::Vector<double> const &
+  minitensor::Vector<double> const
   normal = getNormal(face_id);
 
   minitensor::Vector<double> const
@@ -132,15 +134,222 @@ FractureCriterionTraction::check(
   return effective_traction >= critical_traction_;
 }
 
-minitensor::Vector<double> const &
+stk::mesh::EntityVector
+FractureCriterionTraction::checkAll(
+    stk::mesh::BulkData & bulk_data,
+    stk::mesh::EntityVector const & interfaces)
+{
+  EntityVectorIndex const
+  number_faces = interfaces.size();
+
+  int const
+  dimension = get_space_dimension();
+
+  int const
+  dimension2 = dimension * dimension;
+
+  shards::CellTopology const
+  cell_topology = get_cell_topology();
+
+  stk::mesh::EntityRank const
+  side_rank = get_meta_data().side_rank();
+
+  // Gather pass. Faces not embedded in the bulk part get an empty
+  // node range and a zero normal, and are skipped by the kernel.
+  std::vector<int>
+  is_embedded(number_faces, 0);
+
+  std::vector<EntityVectorIndex>
+  node_offsets(number_faces + 1, 0);
+
+  std::vector<double const *>
+  node_stress;
+
+  node_stress.reserve(number_faces * 4);
+
+  std::vector<double>
+  normals(number_faces * dimension, 0.0);
+
+  for (EntityVectorIndex f = 0; f < number_faces; ++f) {
+
+    stk::mesh::Entity
+    interface = interfaces[f];
+
+    node_offsets[f] = node_stress.size();
+
+    assert(bulk_data.num_elements(interface) == 2);
+
+    stk::mesh::Entity const *
+    cells = bulk_data.begin_elements(interface);
+
+    bool const
+    embedded =
+        bulk_data.bucket(cells[0]).member(get_bulk_part()) &&
+        bulk_data.bucket(cells[1]).member(get_bulk_part());
+
+    if (embedded == false) continue;
+
+    is_embedded[f] = 1;
+
+    // Same node ordering as Topology::getBoundaryEntityNodes
+    stk::mesh::Entity
+    first_cell = cells[0];
+
+    size_t const
+    num_cell_nodes = bulk_data.num_nodes(first_cell);
+
+    stk::mesh::Entity const *
+    cell_nodes = bulk_data.begin_nodes(first_cell);
+
+    stk::mesh::ConnectivityOrdinal const *
+    node_ords = bulk_data.begin_node_ordinals(first_cell);
+
+    EdgeId const
+    face_order = bulk_data.begin_element_ordinals(interface)[0];
+
+    RelationVectorIndex const
+    number_face_nodes = cell_topology.getNodeCount(side_rank, face_order);
+
+    for (RelationVectorIndex i = 0; i < number_face_nodes; ++i) {
+
+      EdgeId const
+      cell_order = cell_topology.getNodeMap(side_rank, face_order, i);
+
+      for (size_t j = 0; j < num_cell_nodes; ++j) {
+        if (node_ords[j] == cell_order) {
+          node_stress.push_back(
+              stk::mesh::field_data(*stress_field_, cell_nodes[j]));
+        }
+      }
+    }
+
+    stk::mesh::EntityId const
+    face_id = get_bulk_data().identifier(interface);
+
+    std::unordered_map<stk::mesh::EntityId, EntityVectorIndex>::const_iterator
+    it = normal_index_.find(face_id);
+
+    assert(it != normal_index_.end());
+
+    std::copy(
+        &normals_[it->second * dimension],
+        &normals_[it->second * dimension] + dimension,
+        &normals[f * dimension]);
+  }
+
+  node_offsets[number_faces] = node_stress.size();
+
+  // Evaluation pass over the flat arrays.
+  std::vector<int>
+  is_open(number_faces, 0);
+
+  double const
+  critical_traction = critical_traction_;
+
+  double const
+  beta = beta_;
+
+  int * const
+  open_data = is_open.data();
+
+  int const * const
+  embedded_data = is_embedded.data();
+
+  EntityVectorIndex const * const
+  offsets_data = node_offsets.data();
+
+  double const * const * const
+  stress_data = node_stress.data();
+
+  double const * const
+  normals_data = normals.data();
+
+  Kokkos::parallel_for(
+    Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, number_faces),
+    [=](int const f) {
+
+      if (embedded_data[f] == 0) return;
+
+      EntityVectorIndex const
+      begin = offsets_data[f];
+
+      EntityVectorIndex const
+      end = offsets_data[f + 1];
+
+      // The traction is evaluated at centroid of face, so a simple
+      // average yields the value. Space dimension is 2 or 3, as
+      // enforced by computeNormals.
+      double
+      stress[9] = {0.0};
+
+      for (EntityVectorIndex n = begin; n < end; ++n) {
+        for (int k = 0; k < dimension2; ++k) {
+          stress[k] += stress_data[n][k];
+        }
+      }
+
+      double const
+      scale = 1.0 / static_cast<double>(end - begin);
+
+      double const * const
+      normal = &normals_data[f * dimension];
+
+      double
+      traction[3] = {0.0};
+
+      double
+      t_n = 0.0;
+
+      for (int i = 0; i < dimension; ++i) {
+        for (int j = 0; j < dimension; ++j) {
+          traction[i] += scale * stress[i * dimension + j] * normal[j];
+        }
+        t_n += traction[i] * normal[i];
+      }
+
+      double
+      t_s2 = 0.0;
+
+      for (int i = 0; i < dimension; ++i) {
+        double const
+        shear = traction[i] - t_n * normal[i];
+
+        t_s2 += shear * shear;
+      }
+
+      // Ignore compression
+      t_n = std::max(t_n, 0.0);
+
+      double const
+      effective_traction = std::sqrt(t_s2 / beta / beta + t_n * t_n);
+
+      open_data[f] = effective_traction >= critical_traction ? 1 : 0;
+    });
+
+  stk::mesh::EntityVector
+  open;
+
+  for (EntityVectorIndex f = 0; f < number_faces; ++f) {
+    if (is_open[f] == 1) open.push_back(interfaces[f]);
+  }
+
+  return open;
+}
+
+minitensor::Vector<double>
 FractureCriterionTraction::getNormal(stk::mesh::EntityId const entity_id)
 {
-  std::map<stk::mesh::EntityId, minitensor::Vector<double>>::const_iterator
-  it = normals_.find(entity_id);
+  std::unordered_map<stk::mesh::EntityId, EntityVectorIndex>::const_iterator
+  it = normal_index_.find(entity_id);
 
-  assert(it != normals_.end());
+  assert(it != normal_index_.end());
 
-  return it->second;
+  minitensor::Vector<double>
+  normal(get_space_dimension());
+
+  normal.fill(&normals_[it->second * get_space_dimension()]);
+
+  return normal;
 }
 
 void
@@ -187,6 +396,8 @@ FractureCriterionTraction::computeNormals()
   EntityVectorIndex const
   number_normals = faces.size();
 
+  normals_.resize(number_normals * get_space_dimension());
+
   // Use low level id functions from BulkData instead of the mapping
   // functions for entity ids from the Topology class as the local
   // element mapping functions expect the former.
@@ -285,7 +496,11 @@ FractureCriterionTraction::computeNormals()
 
     }
 
-    normals_.insert(std::make_pair(face_id, normal));
+    for (minitensor::Index j = 0; j < get_space_dimension(); ++j) {
+      normals_[i * get_space_dimension() + j] = normal(j);
+    }
+
+    normal_index_.insert(std::make_pair(face_id, i));
   }
 
 }
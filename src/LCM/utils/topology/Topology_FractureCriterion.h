@@ -13,6 +13,7 @@
 #define LCM_Topology_FractureCriterion_h
 
 #include <cassert>
+#include <unordered_map>
 
 #include <stk_mesh/base/FieldBase.hpp>
 
@@ -51,6 +52,26 @@ public:
   bool
   check(stk::mesh::BulkData & mesh, stk::mesh::Entity interface) = 0;
 
+  ///
+  /// Check a batch of interfaces. Returns the ones that open, in the
+  /// order given. By default each interface is checked in turn.
+  ///
+  virtual
+  stk::mesh::EntityVector
+  checkAll(
+      stk::mesh::BulkData & mesh,
+      stk::mesh::EntityVector const & interfaces)
+  {
+    stk::mesh::EntityVector
+    open;
+
+    for (EntityVectorIndex i = 0; i < interfaces.size(); ++i) {
+      if (check(mesh, interfaces[i]) == true) open.push_back(interfaces[i]);
+    }
+
+    return open;
+  }
+
   virtual
   ~AbstractFractureCriterion()
   {
@@ -249,13 +270,23 @@ public:
   bool
   check(stk::mesh::BulkData & bulk_data, stk::mesh::Entity interface);
 
+  ///
+  /// Gathers face-to-node connectivity, normals and the bulk
+  /// interface mask for all candidates in one pass and then
+  /// evaluates the traction criterion over the flat arrays.
+  ///
+  stk::mesh::EntityVector
+  checkAll(
+      stk::mesh::BulkData & bulk_data,
+      stk::mesh::EntityVector const & interfaces);
+
 private:
 
   FractureCriterionTraction();
   FractureCriterionTraction(FractureCriterionTraction const &);
   FractureCriterionTraction & operator=(FractureCriterionTraction const &);
 
-  minitensor::Vector<double> const &
+  minitensor::Vector<double>
   getNormal(stk::mesh::EntityId const entity_id);
 
   void
@@ -272,8 +303,13 @@ private:
   double
   beta_;
 
-  std::map<stk::mesh::EntityId, minitensor::Vector<double>>
+  // Unit normals of the locally owned faces, space dimension per face,
+  // and the position of each face in that array.
+  std::vector<double>
   normals_;
+
+  std::unordered_map<stk::mesh::EntityId, EntityVectorIndex>
+  normal_index_;
 };
 
 } // namespace LCM
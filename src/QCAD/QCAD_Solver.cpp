@@ -36,6 +36,11 @@ Please remove when issue is resolved
 #include "AnasaziBasicEigenproblem.hpp"
 #include "AnasaziBlockDavidsonSolMgr.hpp"
 #include "AnasaziBasicOutputManager.hpp"
+#include "Piro_StratimikosUtils.hpp"
+#include "Stratimikos_DefaultLinearSolverBuilder.hpp"
+#include "Thyra_EpetraLinearOp.hpp"
+#include "Thyra_EpetraThyraWrappers.hpp"
+#include "Thyra_LinearOpWithSolveFactoryHelpers.hpp"
 #endif
 
 
@@ -145,6 +150,7 @@ Solver(const Teuchos::RCP<Teuchos::ParameterList>& appParams,
 
   eigensolverName = problemParams.get<string>("Schrodinger Eigensolver","LOBPCG");
   bRealEvecs = problemParams.get<bool>("Eigenvectors are Real",false);
+  bBlockCoulombSolve = problemParams.get<bool>("Block Coulomb Poisson Solve",false);
 
   // Get problem parameters used for iterating Poisson-Schrodinger loop
   if(problemNameBase == "Poisson Schrodinger" || problemNameBase == "Poisson Schrodinger CI") {
@@ -1492,7 +1498,13 @@ QCAD::Solver::evalCIModel(const InArgs& inArgs,
 
   // Construct CI matrices:
   ciSolver.fill1Pmx(eigenDataToPass);
-  if(!bRealEvecs) {
+  if(bBlockCoulombSolve) {
+    ciSolver.fill2PmxBlockSolve(eigenDataToPass, &subSolvers["CoulombPoisson"], getSubSolverParams("CoulombPoisson"),
+          bRealEvecs ? NULL : &subSolvers["CoulombPoissonIm"],
+          bRealEvecs ? Teuchos::RCP<Teuchos::ParameterList>() : getSubSolverParams("CoulombPoissonIm"),
+          rcp_nullvec, bRealEvecs, bVerbose);
+  }
+  else if(!bRealEvecs) {
     ciSolver.fill2Pmx(eigenDataToPass, &subSolvers["CoulombPoisson"],
           &subSolvers["CoulombPoissonIm"], rcp_nullvec, bRealEvecs, bVerbose);
   }
@@ -1653,10 +1665,19 @@ QCAD::Solver::evalPoissonCIModel(const InArgs& inArgs,
   if(!bRealEvecs) {
     subSolvers[ "CoulombPoissonIm" ] = CreateSubSolver( "CoulombPoissonIm", getSubSolverParams("CoulombPoissonIm") , *solverComm);
     fillSingleSubSolverParams(inArgs, "Poisson", subSolvers[ "CoulombPoissonIm" ]);
-    ciSolver.fill2Pmx(eigenDataToPass, &subSolvers["CoulombPoisson"], &subSolvers["CoulombPoissonIm"],
-          g_noCharge, bRealEvecs, bVerbose);
+    if(bBlockCoulombSolve)
+      ciSolver.fill2PmxBlockSolve(eigenDataToPass, &subSolvers["CoulombPoisson"], getSubSolverParams("CoulombPoisson"),
+            &subSolvers["CoulombPoissonIm"], getSubSolverParams("CoulombPoissonIm"),
+            g_noCharge, bRealEvecs, bVerbose);
+    else
+      ciSolver.fill2Pmx(eigenDataToPass, &subSolvers["CoulombPoisson"], &subSolvers["CoulombPoissonIm"],
+            g_noCharge, bRealEvecs, bVerbose);
     subSolvers[ "CoulombPoissonIm" ].freeUp();
   }
+  else if(bBlockCoulombSolve) {
+    ciSolver.fill2PmxBlockSolve(eigenDataToPass, &subSolvers["CoulombPoisson"], getSubSolverParams("CoulombPoisson"),
+          NULL, Teuchos::null, g_noCharge, bRealEvecs, bVerbose);
+  }
   else {
     ciSolver.fill2Pmx(eigenDataToPass, &subSolvers["CoulombPoisson"], NULL,
           g_noCharge, bRealEvecs, bVerbose);
@@ -2363,6 +2384,7 @@ QCAD::Solver::getValidProblemParameters() const
   validPL->set<int>("CI Particles", 0, "Schrodinger CI mode only: the number of particles to use in the CI phase");
   validPL->set<int>("CI Excitations", 0, "Schrodinger CI mode only: the number of excitations with which to truncate the CI phase");
   validPL->set<bool>("Use S2 Symmetry in CI",false,"Use total spin symmetry in the CI part of a problem");
+  validPL->set<bool>("Block Coulomb Poisson Solve",false,"Assemble the (linear) Coulomb Poisson operator once and solve all eigenvector-pair sources as a single multi-RHS linear system");
 
   validPL->set<bool>("Include exchange-correlation potential",false,"Include exchange-correlation potential in poisson source term");
   validPL->set<bool>("Only solve schrodinger in quantum blocks",true,"Limit schrodinger solution to elements blocks labeled as quantum in the materials DB");
@@ -3092,89 +3114,118 @@ void QCAD::CISolver::fill2Pmx(Teuchos::RCP<Albany::EigendataStruct> eigenData1P,
       QCAD::SolveModel(*coulombSolver, eigenData1P, eigenDataNull);
       g_reSrc = coulombSolver->responses_out->get_g(0); //only use *first* response vector
 
-      *out << "DEBUG: g_reSrc vector:" << std::endl; //DEBUG
-      for(int i=0; i< g_reSrc->MyLength(); i++) *out << "  g_reSrc[" << i << "] = " << (*g_reSrc)[i] << std::endl;
-
+      if(bVerbose) {
+        *out << "DEBUG: g_reSrc vector:" << std::endl; //DEBUG
+        for(int i=0; i< g_reSrc->MyLength(); i++) *out << "  g_reSrc[" << i << "] = " << (*g_reSrc)[i] << std::endl;
+      }
 
       if(!bRealEvecs) {
-  // Coulomb Poisson Solve - get imaginary coulomb els in reponse vector
-  if(bVerbose) *out << "QCAD Solve: Imaginary Coulomb " << i2 << "," << i4 << " Poisson" << std::endl;
-  SetCoulombParams( coulombSolver_ImPart->params_in, i2,i4 );
-  QCAD::SolveModel(*coulombSolver_ImPart, eigenData1P, eigenDataNull);
-  g_imSrc = coulombSolver_ImPart->responses_out->get_g(0); //only use *first* response vector
-
-  *out << "DEBUG: g_imSrc vector:" << std::endl; //DEBUG
-  for(int i=0; i< g_imSrc->MyLength(); i++) *out << "  g_imSrc[" << i << "] = " << (*g_imSrc)[i] << std::endl;
+        // Coulomb Poisson Solve - get imaginary coulomb els in reponse vector
+        if(bVerbose) *out << "QCAD Solve: Imaginary Coulomb " << i2 << "," << i4 << " Poisson" << std::endl;
+        SetCoulombParams( coulombSolver_ImPart->params_in, i2,i4 );
+        QCAD::SolveModel(*coulombSolver_ImPart, eigenData1P, eigenDataNull);
+        g_imSrc = coulombSolver_ImPart->responses_out->get_g(0); //only use *first* response vector
+
+        if(bVerbose) {
+          *out << "DEBUG: g_imSrc vector:" << std::endl; //DEBUG
+          for(int i=0; i< g_imSrc->MyLength(); i++) *out << "  g_imSrc[" << i << "] = " << (*g_imSrc)[i] << std::endl;
+        }
       }
 
-      if(g_noCharge != Teuchos::null) {
-  *out << "DEBUG: g_noCharge vector:" << std::endl; //DEBUG
-  for(int i=0; i< g_noCharge->MyLength(); i++) *out << "  g_noCharge[" << i << "] = " << (*g_noCharge)[i] << std::endl;
-      }
+      Set2PmxElements(i2, i4, g_reSrc, g_imSrc, g_noCharge, bRealEvecs, bVerbose);
+    }
+  }
 
-      int rIndx = 0 ;  // offset to the responses corresponding to Coulomb_ij values == 0 by construction
+  mx2P = Teuchos::rcp(new AlbanyCI::BlockTensor<AlbanyCI::dcmplx>(basis1P, blocks2P, 2));
+  //*out << std::endl << "DEBUG CI mx2P:"; mx2P->print(out); //DEBUG
+}
 
-      if(!bRealEvecs) {
-  for(int i1=0; i1<n1PperBlock; i1++) {
-    for(int i3=i1; i3<n1PperBlock; i3++) {
-      assert(rIndx < g_reSrc->MyLength()); //make sure g-vector is long enough
-      double c_reSrc_re = -(*g_reSrc)[rIndx];
-      double c_reSrc_im = -(*g_reSrc)[rIndx+1]; // rIndx + 1 == imag part
-      double c_imSrc_re = -(*g_imSrc)[rIndx];
-      double c_imSrc_im = -(*g_imSrc)[rIndx+1]; // rIndx + 1 == imag part
-
-      if(g_noCharge != Teuchos::null) { // subtract out no-charge contribution, if necessary (only in Poisson-CI)
-        // For example, we want c_reSrc_re == -((*g_reSrc)[rIndx] - (*g_noCharge)[rIndx]); //NOTE overall minus sign --> += here
-        c_reSrc_re += (*g_noCharge)[rIndx];
-        c_reSrc_im += (*g_noCharge)[rIndx+1]; // rIndx + 1 == imag part
-        c_imSrc_re += (*g_noCharge)[rIndx];
-        c_imSrc_im += (*g_noCharge)[rIndx+1]; // rIndx + 1 == imag part
-      }
 
-      //Coulomb integral of interest (see above)
-      double c_re = c_reSrc_re - c_imSrc_im;
-      double c_im = c_reSrc_im + c_imSrc_re;
+// Same as fill2Pmx, but exploits the linearity of the Coulomb Poisson problem: the operator
+//  does not depend on the source eigenvector pair (i2,i4), so it is assembled and preconditioned
+//  once and all pair sources are solved together as a single multi-RHS linear system.
+void QCAD::CISolver::fill2PmxBlockSolve(Teuchos::RCP<Albany::EigendataStruct> eigenData1P,
+            const SolverSubSolver* coulombSolver,
+            const Teuchos::RCP<Teuchos::ParameterList>& coulombAppParams,
+            const SolverSubSolver* coulombSolver_ImPart,
+            const Teuchos::RCP<Teuchos::ParameterList>& coulombImAppParams,
+            const Teuchos::RCP<Epetra_Vector>& g_noCharge,
+            bool bRealEvecs, bool bVerbose)
+{
+  std::vector<std::pair<int,int> > pairs;
+  for(int i2=0; i2<n1PperBlock; i2++)
+    for(int i4=i2; i4<n1PperBlock; i4++)
+      pairs.push_back(std::make_pair(i2,i4));
 
-      *out << "DEBUG CI 2P Block El (" <<i1<<","<<i2<<","<<i3<<","<<i4<<") = " << c_re << " + i*" << c_im << std::endl;
+  std::vector<Teuchos::RCP<Epetra_Vector> > g_reSrcs, g_imSrcs;
 
-      // Only use REAL parts here since we don't have complex support yet
-      //  (Tpetra doesn't work).  Use c_re + i*c_im or conjugate where necessary.
-      blockUU->el(i1,i2,i3,i4) = c_re;
-      blockUU->el(i3,i2,i1,i4) = c_re;
-      blockUU->el(i1,i4,i3,i2) = c_re;
-      blockUU->el(i3,i4,i1,i2) = c_re;
+  if(bVerbose) *out << "QCAD Solve: Coulomb Poisson block solve (" << pairs.size() << " sources)" << std::endl;
+  SolveCoulombPairs(*coulombSolver, coulombAppParams, eigenData1P, pairs, g_reSrcs, bVerbose);
 
-      blockUD->el(i1,i2,i3,i4) = c_re;
-      blockUD->el(i3,i2,i1,i4) = c_re;
-      blockUD->el(i1,i4,i3,i2) = c_re;
-      blockUD->el(i3,i4,i1,i2) = c_re;
+  if(!bRealEvecs) {
+    if(bVerbose) *out << "QCAD Solve: Imaginary Coulomb Poisson block solve (" << pairs.size() << " sources)" << std::endl;
+    SolveCoulombPairs(*coulombSolver_ImPart, coulombImAppParams, eigenData1P, pairs, g_imSrcs, bVerbose);
+  }
 
-      blockDU->el(i1,i2,i3,i4) = c_re;
-      blockDU->el(i3,i2,i1,i4) = c_re;
-      blockDU->el(i1,i4,i3,i2) = c_re;
-      blockDU->el(i3,i4,i1,i2) = c_re;
+  Teuchos::RCP<Epetra_Vector> g_imSrc;
+  for(std::size_t k=0; k < pairs.size(); k++) {
+    if(!bRealEvecs) g_imSrc = g_imSrcs[k];
+    Set2PmxElements(pairs[k].first, pairs[k].second, g_reSrcs[k], g_imSrc, g_noCharge, bRealEvecs, bVerbose);
+  }
 
-      blockDD->el(i1,i2,i3,i4) = c_re;
-      blockDD->el(i3,i2,i1,i4) = c_re;
-      blockDD->el(i1,i4,i3,i2) = c_re;
-      blockDD->el(i3,i4,i1,i2) = c_re;
+  mx2P = Teuchos::rcp(new AlbanyCI::BlockTensor<AlbanyCI::dcmplx>(basis1P, blocks2P, 2));
+}
 
-      rIndx += 2;
-    }
+
+void QCAD::CISolver::Set2PmxElements(int i2, int i4, const Teuchos::RCP<Epetra_Vector>& g_reSrc,
+            const Teuchos::RCP<Epetra_Vector>& g_imSrc,
+            const Teuchos::RCP<Epetra_Vector>& g_noCharge,
+            bool bRealEvecs, bool bVerbose)
+{
+  if(bVerbose && g_noCharge != Teuchos::null) {
+    *out << "DEBUG: g_noCharge vector:" << std::endl; //DEBUG
+    for(int i=0; i< g_noCharge->MyLength(); i++) *out << "  g_noCharge[" << i << "] = " << (*g_noCharge)[i] << std::endl;
   }
-      }
-      else { //for all-real eigenvectors
+
+  int rIndx = 0 ;  // offset to the responses corresponding to Coulomb_ij values == 0 by construction
+
   for(int i1=0; i1<n1PperBlock; i1++) {
     for(int i3=i1; i3<n1PperBlock; i3++) {
       assert(rIndx < g_reSrc->MyLength()); //make sure g-vector is long enough
-      double c_reSrc_re = -(*g_reSrc)[rIndx];
+      double c_re;
+
+      if(!bRealEvecs) {
+        double c_reSrc_re = -(*g_reSrc)[rIndx];
+        double c_reSrc_im = -(*g_reSrc)[rIndx+1]; // rIndx + 1 == imag part
+        double c_imSrc_re = -(*g_imSrc)[rIndx];
+        double c_imSrc_im = -(*g_imSrc)[rIndx+1]; // rIndx + 1 == imag part
+
+        if(g_noCharge != Teuchos::null) { // subtract out no-charge contribution, if necessary (only in Poisson-CI)
+          // For example, we want c_reSrc_re == -((*g_reSrc)[rIndx] - (*g_noCharge)[rIndx]); //NOTE overall minus sign --> += here
+          c_reSrc_re += (*g_noCharge)[rIndx];
+          c_reSrc_im += (*g_noCharge)[rIndx+1]; // rIndx + 1 == imag part
+          c_imSrc_re += (*g_noCharge)[rIndx];
+          c_imSrc_im += (*g_noCharge)[rIndx+1]; // rIndx + 1 == imag part
+        }
+
+        //Coulomb integral of interest (see above)
+        c_re = c_reSrc_re - c_imSrc_im;
+        double c_im = c_reSrc_im + c_imSrc_re;
+
+        if(bVerbose) *out << "DEBUG CI 2P Block El (" <<i1<<","<<i2<<","<<i3<<","<<i4<<") = " << c_re << " + i*" << c_im << std::endl;
+        rIndx += 2;
+      }
+      else { //for all-real eigenvectors
+        double c_reSrc_re = -(*g_reSrc)[rIndx];
 
-      if(g_noCharge != Teuchos::null) c_reSrc_re += (*g_noCharge)[rIndx];
+        if(g_noCharge != Teuchos::null) c_reSrc_re += (*g_noCharge)[rIndx];
 
-      //Coulomb integral of interest (see above)
-      double c_re = c_reSrc_re;
+        //Coulomb integral of interest (see above)
+        c_re = c_reSrc_re;
 
-      *out << "DEBUG CI 2P Block El (" <<i1<<","<<i2<<","<<i3<<","<<i4<<") = " << c_re  << std::endl;
+        if(bVerbose) *out << "DEBUG CI 2P Block El (" <<i1<<","<<i2<<","<<i3<<","<<i4<<") = " << c_re  << std::endl;
+        rIndx += 1; // assume no imaginary parts are computed in responses
+      }
 
       // Only use REAL parts here since we don't have complex support yet
       //  (Tpetra doesn't work).  Use c_re + i*c_im or conjugate where necessary.
@@ -3197,16 +3248,77 @@ void QCAD::CISolver::fill2Pmx(Teuchos::RCP<Albany::EigendataStruct> eigenData1P,
       blockDD->el(i3,i2,i1,i4) = c_re;
       blockDD->el(i1,i4,i3,i2) = c_re;
       blockDD->el(i3,i4,i1,i2) = c_re;
-
-      rIndx += 1; // assume no imaginary parts are computed in responses
-    }
-  }
-      }
     }
   }
+}
 
-  mx2P = Teuchos::rcp(new AlbanyCI::BlockTensor<AlbanyCI::dcmplx>(basis1P, blocks2P, 2));
-  //*out << std::endl << "DEBUG CI mx2P:"; mx2P->print(out); //DEBUG
+
+void QCAD::CISolver::SolveCoulombPairs(const SolverSubSolver& coulombSolver,
+            const Teuchos::RCP<Teuchos::ParameterList>& coulombAppParams,
+            Teuchos::RCP<Albany::EigendataStruct> eigenData1P,
+            const std::vector<std::pair<int,int> >& pairs,
+            std::vector<Teuchos::RCP<Epetra_Vector> >& g_pairs, bool bVerbose) const
+{
+  using Teuchos::RCP;
+  using Teuchos::rcp;
+
+  const int nPairs = pairs.size();
+  g_pairs.resize(nPairs);
+  if(nPairs == 0) return;
+
+  coulombSolver.app->getStateMgr().setEigenData(eigenData1P);
+
+  // Evaluate the underlying Albany model directly (bypassing the Piro nonlinear solver)
+  Albany::ModelEvaluator model(coulombSolver.app, coulombAppParams);
+
+  RCP<const Epetra_Vector> x0 = model.get_x_init();
+  RCP<Epetra_Operator> W = model.create_W();
+  RCP<Epetra_MultiVector> rhs = rcp(new Epetra_MultiVector(*(model.get_f_map()), nPairs, true));
+  RCP<Epetra_MultiVector> dx = rcp(new Epetra_MultiVector(*(model.get_x_map()), nPairs, true));
+
+  RCP<EpetraExt::ModelEvaluator::InArgs> inArgs = rcp(new EpetraExt::ModelEvaluator::InArgs(model.createInArgs()));
+  inArgs->set_p(0, coulombSolver.params_in->get_p(0));
+
+  // Residuals of all pair sources at x0, Jacobian (shared by all pairs) only with the first one
+  inArgs->set_x(x0);
+  for(int k=0; k < nPairs; k++) {
+    SetCoulombParams(inArgs, pairs[k].first, pairs[k].second);
+    EpetraExt::ModelEvaluator::OutArgs outArgs = model.createOutArgs();
+    outArgs.set_f(Teuchos::rcpFromRef(*(*rhs)(k)));
+    if(k == 0) outArgs.set_W(W);
+    model.evalModel(*inArgs, outArgs);
+  }
+  rhs->Scale(-1.0);
+
+  // Single preconditioner setup and one block solve for all right hand sides.
+  // The builder gets the same preconditioner registrations as Albany's solvers.
+  Stratimikos::DefaultLinearSolverBuilder linearSolverBuilder;
+  Albany::SolverFactory::setupLinearSolverBuilder(linearSolverBuilder,
+    Piro::extractStratimikosParams(Teuchos::sublist(coulombAppParams, "Piro")));
+  RCP<Thyra::LinearOpWithSolveFactoryBase<double> > lowsFactory =
+    linearSolverBuilder.createLinearSolveStrategy("");
+  RCP<Thyra::LinearOpWithSolveBase<double> > lows =
+    Thyra::linearOpWithSolve(*lowsFactory, Thyra::epetraLinearOp(W));
+
+  RCP<const Thyra::VectorSpaceBase<double> > space = Thyra::create_VectorSpace(model.get_x_map());
+  Thyra::SolveStatus<double> status =
+    Thyra::solve<double>(*lows, Thyra::NOTRANS, *Thyra::create_MultiVector(rhs, space),
+                         Thyra::create_MultiVector(dx, space).ptr());
+  if(status.solveStatus != Thyra::SOLVE_STATUS_CONVERGED)
+    *out << "QCAD Solve: WARNING - Coulomb Poisson block solve did not report convergence: "
+         << status.message << std::endl;
+
+  // Coulomb integral responses of each pair's potential (x0 + dx_k)
+  Epetra_Vector xk(*x0);
+  inArgs->set_x(Teuchos::rcpFromRef(xk));
+  for(int k=0; k < nPairs; k++) {
+    xk.Update(1.0, *(*dx)(k), 1.0, *x0, 0.0);
+    SetCoulombParams(inArgs, pairs[k].first, pairs[k].second);
+    EpetraExt::ModelEvaluator::OutArgs outArgs = model.createOutArgs();
+    g_pairs[k] = rcp(new Epetra_Vector(*(model.get_g_map(0))));
+    outArgs.set_g(0, g_pairs[k]);
+    model.evalModel(*inArgs, outArgs);
+  }
 }
 
 
@@ -172,6 +172,7 @@ namespace QCAD {
     double fixedPSOcc;
     bool   bUseIntegratedPS;
     bool   bUseTotalSpinSymmetry; // use S2 symmetry in CI calculation
+    bool   bBlockCoulombSolve;    // solve all Coulomb Poisson source pairs as one block linear system
   };
 
 
@@ -267,6 +268,13 @@ namespace QCAD {
       const SolverSubSolver* coulombSolver_ImPart,
       const Teuchos::RCP<Epetra_Vector>& g_noCharge,
       bool bRealEvecs, bool bVerbose);
+    void fill2PmxBlockSolve(Teuchos::RCP<Albany::EigendataStruct> eigenData1P,
+      const SolverSubSolver* coulombSolver,
+      const Teuchos::RCP<Teuchos::ParameterList>& coulombAppParams,
+      const SolverSubSolver* coulombSolver_ImPart,
+      const Teuchos::RCP<Teuchos::ParameterList>& coulombImAppParams,
+      const Teuchos::RCP<Epetra_Vector>& g_noCharge,
+      bool bRealEvecs, bool bVerbose);
 
     Teuchos::RCP<AlbanyCI::Solution> Solve(Teuchos::RCP<Teuchos::ParameterList> AlbanyCIList) const;
 
@@ -276,6 +284,15 @@ namespace QCAD {
 
   private:
     void SetCoulombParams(const Teuchos::RCP<EpetraExt::ModelEvaluator::InArgs> inArgs, int i2, int i4) const;
+    void Set2PmxElements(int i2, int i4, const Teuchos::RCP<Epetra_Vector>& g_reSrc,
+       const Teuchos::RCP<Epetra_Vector>& g_imSrc,
+       const Teuchos::RCP<Epetra_Vector>& g_noCharge,
+       bool bRealEvecs, bool bVerbose);
+    void SolveCoulombPairs(const SolverSubSolver& coulombSolver,
+       const Teuchos::RCP<Teuchos::ParameterList>& coulombAppParams,
+       Teuchos::RCP<Albany::EigendataStruct> eigenData1P,
+       const std::vector<std::pair<int,int> >& pairs,
+       std::vector<Teuchos::RCP<Epetra_Vector> >& g_pairs, bool bVerbose) const;
 
   private:
     // number of single particle states of each type of spin (up / down)
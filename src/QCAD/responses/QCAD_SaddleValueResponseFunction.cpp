@@ -72,6 +72,9 @@ SaddleValueResponseFunction(
   bClimbing      = params.get<bool>("Climbing NEB", true);
   antiKinkFactor = params.get<double>("Anti-Kink Factor", 0.0);
   bAggregateWorksets = params.get<bool>("Aggregate Worksets", false);
+  binSize = 0.0;
+  for(int k=0; k<MAX_DIMENSIONS; k++) { binOrigin[k] = 0.0; nBins[k] = 1; }
+  binPtIndices.resize(1);
   bAdaptivePointSize = params.get<bool>("Adaptive Image Point Size", false);
   minAdaptivePointWt = params.get<double>("Adaptive Min Point Weight", 5);
   maxAdaptivePointWt = params.get<double>("Adaptive Max Point Weight", 10);
@@ -401,6 +404,8 @@ initializeImagePoints(const double current_time,
     Albany::FieldManagerScalarResponseFunction::evaluateResponseT(
 				    current_time, xdotT.get(), NULL, *xT, p, *gT);
     //No MPI here - each proc only holds all of it's worksets -- not other procs worksets
+
+    buildPointBins();
   }
 
 
@@ -546,6 +551,8 @@ initializeImagePointsT(const double current_time,
     Albany::FieldManagerScalarResponseFunction::evaluateResponseT(
 				    current_time, xdotT, NULL, xT, p, gT);
     //No MPI here - each proc only holds all of it's worksets -- not other procs worksets
+
+    buildPointBins();
   }
 }
 
@@ -2115,9 +2122,7 @@ getImagePointValues(const double current_time,
 
   if(bAggregateWorksets) {
     //Use cached field and coordinate values to perform fill    
-    for(std::size_t i=0; i<vFieldValues.size(); i++) {
-      addImagePointData( vCoords[i].data, vFieldValues[i], vGrads[i].data );
-    } 
+    addAggregatedImagePointData();
   }
   else {
     mode = "Collect image point data";
@@ -2134,10 +2139,16 @@ getImagePointValues(const double current_time,
 				     current_time, xdotT.get(), NULL, *xT, p, *gT);
   }
 
-  //MPI -- sum weights, value, and gradient for each image pt
-  comm->SumAll( imagePtValues.data(),    globalPtValues,  nImagePts );
-  comm->SumAll( imagePtWeights.data(),   globalPtWeights, nImagePts );
-  comm->SumAll( imagePtGradComps.data(), globalPtGrads,   nImagePts*numDims );
+  //MPI -- sum weights, value, and gradient for each image pt in a single packed reduction
+  std::size_t nPacked = nImagePts*(2+numDims);
+  std::vector<double> localPacked(nPacked), globalPacked(nPacked);
+  std::copy(imagePtValues.data(), imagePtValues.data()+nImagePts, localPacked.begin());
+  std::copy(imagePtWeights.data(), imagePtWeights.data()+nImagePts, localPacked.begin()+nImagePts);
+  std::copy(imagePtGradComps.data(), imagePtGradComps.data()+nImagePts*numDims, localPacked.begin()+2*nImagePts);
+  comm->SumAll( localPacked.data(), globalPacked.data(), nPacked );
+  std::copy(globalPacked.begin(), globalPacked.begin()+nImagePts, globalPtValues);
+  std::copy(globalPacked.begin()+nImagePts, globalPacked.begin()+2*nImagePts, globalPtWeights);
+  std::copy(globalPacked.begin()+2*nImagePts, globalPacked.end(), globalPtGrads);
 
   // Put summed data into imagePts, normalizing value and 
   //   gradient from different cell contributions
@@ -2185,9 +2196,7 @@ getFinalImagePointValues(const double current_time,
 
   if(bAggregateWorksets) {
     //Use cached field and coordinate values to perform fill    
-    for(std::size_t i=0; i<vFieldValues.size(); i++) {
-      addFinalImagePointData( vCoords[i].data, vFieldValues[i] );
-    } 
+    addAggregatedFinalImagePointData();
   }
   else {
     mode = "Collect final image point data";
@@ -2207,10 +2216,12 @@ getFinalImagePointValues(const double current_time,
   //MPI -- sum weights, value, and gradient for each image pt
   std::size_t nFinalPts = finalPts.size();
   if(nFinalPts > 0) {
-    double*  globalPtValues   = new double [nFinalPts];
-    double*  globalPtWeights  = new double [nFinalPts];
-    comm->SumAll( finalPtValues.data(),    globalPtValues,  nFinalPts );
-    comm->SumAll( finalPtWeights.data(),   globalPtWeights, nFinalPts );
+    std::vector<double> localPacked(2*nFinalPts), globalPacked(2*nFinalPts);
+    std::copy(finalPtValues.data(), finalPtValues.data()+nFinalPts, localPacked.begin());
+    std::copy(finalPtWeights.data(), finalPtWeights.data()+nFinalPts, localPacked.begin()+nFinalPts);
+    comm->SumAll( localPacked.data(), globalPacked.data(), 2*nFinalPts );
+    const double* globalPtValues  = &globalPacked[0];
+    const double* globalPtWeights = &globalPacked[nFinalPts];
 
     // Put summed data into imagePts, normalizing value from different cell contributions
     for(std::size_t i=0; i<nFinalPts; i++) {
@@ -2263,9 +2274,7 @@ getImagePointValuesT(const double current_time,
 
   if(bAggregateWorksets) {
     //Use cached field and coordinate values to perform fill    
-    for(std::size_t i=0; i<vFieldValues.size(); i++) {
-      addImagePointData( vCoords[i].data, vFieldValues[i], vGrads[i].data );
-    } 
+    addAggregatedImagePointData();
   }
   else {
     mode = "Collect image point data";
@@ -2273,13 +2282,16 @@ getImagePointValuesT(const double current_time,
 				     current_time, xdotT, NULL, xT, p, gT);
   }
 
-  //MPI -- sum weights, value, and gradient for each image pt
-  Teuchos::reduceAll<LO, ST>(*commT, Teuchos::REDUCE_SUM, nImagePts, imagePtValues.data(), globalPtValues); 
-  Teuchos::reduceAll<LO, ST>(*commT, Teuchos::REDUCE_SUM, nImagePts, imagePtWeights.data(), globalPtWeights); 
-  Teuchos::reduceAll<LO, ST>(*commT, Teuchos::REDUCE_SUM, nImagePts*numDims, imagePtGradComps.data(), globalPtGrads); 
-  //comm.SumAll( imagePtValues.data(),    globalPtValues,  nImagePts );
-  //comm.SumAll( imagePtWeights.data(),   globalPtWeights, nImagePts );
-  //comm.SumAll( imagePtGradComps.data(), globalPtGrads,   nImagePts*numDims );
+  //MPI -- sum weights, value, and gradient for each image pt in a single packed reduction
+  std::size_t nPacked = nImagePts*(2+numDims);
+  std::vector<double> localPacked(nPacked), globalPacked(nPacked);
+  std::copy(imagePtValues.data(), imagePtValues.data()+nImagePts, localPacked.begin());
+  std::copy(imagePtWeights.data(), imagePtWeights.data()+nImagePts, localPacked.begin()+nImagePts);
+  std::copy(imagePtGradComps.data(), imagePtGradComps.data()+nImagePts*numDims, localPacked.begin()+2*nImagePts);
+  Teuchos::reduceAll<LO, ST>(*commT, Teuchos::REDUCE_SUM, nPacked, localPacked.data(), globalPacked.data()); 
+  std::copy(globalPacked.begin(), globalPacked.begin()+nImagePts, globalPtValues);
+  std::copy(globalPacked.begin()+nImagePts, globalPacked.begin()+2*nImagePts, globalPtWeights);
+  std::copy(globalPacked.begin()+2*nImagePts, globalPacked.end(), globalPtGrads);
 
   // Put summed data into imagePts, normalizing value and 
   //   gradient from different cell contributions
@@ -2574,6 +2586,123 @@ addFinalImagePointData(const double* p, double value)
   return;
 }
 
+void QCAD::SaddleValueResponseFunction::
+addAggregatedImagePointData()
+{
+  // Only visit the aggregated points lying in bins within the support of each image point
+  double w, effDims = (bLockToPlane && numDims > 2) ? 2 : numDims;
+  int binMin[MAX_DIMENSIONS], binMax[MAX_DIMENSIONS];
+  for(std::size_t i=0; i<nImagePts; i++) {
+    getPointBinRange(imagePts[i].coords, pointFnCutoff(imagePts[i].radius), binMin, binMax);
+    for(int bx=binMin[0]; bx<=binMax[0]; bx++) {
+      for(int by=binMin[1]; by<=binMax[1]; by++) {
+	for(int bz=binMin[2]; bz<=binMax[2]; bz++) {
+	  const std::vector<std::size_t>& bin = binPtIndices[(bz*nBins[1] + by)*nBins[0] + bx];
+	  for(std::size_t j=0; j<bin.size(); j++) {
+	    std::size_t ip = bin[j];
+	    w = pointFn(imagePts[i].coords.distanceTo(vCoords[ip].data) , imagePts[i].radius );
+	    if(w > 0) {
+	      imagePtWeights[i] += w;
+	      imagePtValues[i] += w*vFieldValues[ip];
+	      for(std::size_t k=0; k<effDims; k++)
+		imagePtGradComps[k*nImagePts+i] += w*vGrads[ip].data[k];
+	    }
+	  }
+	}
+      }
+    }
+  }
+  return;
+}
+
+void QCAD::SaddleValueResponseFunction::
+addAggregatedFinalImagePointData()
+{
+  double w;
+  int binMin[MAX_DIMENSIONS], binMax[MAX_DIMENSIONS];
+  for(std::size_t i=0; i< finalPts.size(); i++) {
+    getPointBinRange(finalPts[i].coords, pointFnCutoff(finalPts[i].radius), binMin, binMax);
+    for(int bx=binMin[0]; bx<=binMax[0]; bx++) {
+      for(int by=binMin[1]; by<=binMax[1]; by++) {
+	for(int bz=binMin[2]; bz<=binMax[2]; bz++) {
+	  const std::vector<std::size_t>& bin = binPtIndices[(bz*nBins[1] + by)*nBins[0] + bx];
+	  for(std::size_t j=0; j<bin.size(); j++) {
+	    std::size_t ip = bin[j];
+	    w = pointFn(finalPts[i].coords.distanceTo(vCoords[ip].data) , finalPts[i].radius );
+	    if(w > 0) {
+	      finalPtWeights[i] += w;
+	      finalPtValues[i] += w*vFieldValues[ip];
+	    }
+	  }
+	}
+      }
+    }
+  }
+  return;
+}
+
+void QCAD::SaddleValueResponseFunction::
+buildPointBins()
+{
+  // Bin the aggregated points on a uniform grid sized by the support of an image point,
+  //  so image point updates only visit nearby cells.  The bins are kept until the
+  //  workset data is accumulated again.
+  for(int k=0; k<MAX_DIMENSIONS; k++) { binOrigin[k] = 0.0; nBins[k] = 1; }
+  binSize = pointFnCutoff(imagePtSize);
+  binPtIndices.clear();
+
+  std::size_t nPts = vCoords.size();
+  if(nPts == 0 || binSize <= 0) {
+    binSize = 0.0;
+    binPtIndices.resize(1);
+    for(std::size_t ip=0; ip<nPts; ip++) binPtIndices[0].push_back(ip);
+    return;
+  }
+
+  double binMaxCoord[MAX_DIMENSIONS];
+  for(std::size_t k=0; k<numDims; k++) binOrigin[k] = binMaxCoord[k] = vCoords[0].data[k];
+  for(std::size_t ip=1; ip<nPts; ip++) {
+    for(std::size_t k=0; k<numDims; k++) {
+      binOrigin[k] = std::min(binOrigin[k], vCoords[ip].data[k]);
+      binMaxCoord[k] = std::max(binMaxCoord[k], vCoords[ip].data[k]);
+    }
+  }
+
+  // Coarsen the grid if needed so the number of bins stays comparable to the number of points
+  std::size_t totalBins;
+  while(true) {
+    totalBins = 1;
+    for(std::size_t k=0; k<numDims; k++) {
+      nBins[k] = static_cast<int>((binMaxCoord[k] - binOrigin[k]) / binSize) + 1;
+      totalBins *= nBins[k];
+    }
+    if(totalBins <= 8*nPts) break;
+    binSize *= 2;
+  }
+
+  binPtIndices.resize(totalBins);
+  int b[MAX_DIMENSIONS] = {0};
+  for(std::size_t ip=0; ip<nPts; ip++) {
+    for(std::size_t k=0; k<numDims; k++)
+      b[k] = std::min(static_cast<int>((vCoords[ip].data[k] - binOrigin[k]) / binSize), nBins[k]-1);
+    binPtIndices[(b[2]*nBins[1] + b[1])*nBins[0] + b[0]].push_back(ip);
+  }
+}
+
+void QCAD::SaddleValueResponseFunction::
+getPointBinRange(const mathVector& center, double cutoff, int* binMin, int* binMax) const
+{
+  for(int k=0; k<MAX_DIMENSIONS; k++) { binMin[k] = 0; binMax[k] = nBins[k]-1; }
+  if(binSize <= 0) return;
+
+  for(std::size_t k=0; k<numDims; k++) {
+    double lo = (center[k] - cutoff - binOrigin[k]) / binSize;
+    double hi = (center[k] + cutoff - binOrigin[k]) / binSize;
+    binMin[k] = (lo < 0) ? 0 : std::min(static_cast<int>(lo), nBins[k]-1);
+    binMax[k] = (hi < 0) ? -1 : std::min(static_cast<int>(hi), nBins[k]-1);
+  }
+}
+
 void QCAD::SaddleValueResponseFunction::
 accumulatePointData(const double* p, double value, double* grad)
 {
@@ -2660,6 +2789,12 @@ pointFn(double d, double radius) const {
   return (val >= 1e-2) ? val : 0.0;
 }
 
+double QCAD::SaddleValueResponseFunction::
+pointFnCutoff(double radius) const {
+  // pointFn drops below its 1e-2 threshold when d*d > 2*radius*radius*ln(100)
+  return radius * sqrt(2*log(100.0)) * (1.0 + 1e-8);
+}
+
 int QCAD::SaddleValueResponseFunction::
 getHighestPtIndex() const 
 {
@@ -285,6 +285,16 @@ namespace QCAD {
     //! function giving distribution of weights for "point"
     double pointFn(double d, double radius) const;
 
+    //! distance beyond which pointFn is zero
+    double pointFnCutoff(double radius) const;
+
+    //! helper functions for the spatial bins over aggregated workset data
+    void buildPointBins();
+    void getPointBinRange(const mathVector& center, double cutoff,
+			  int* binMin, int* binMax) const;
+    void addAggregatedImagePointData();
+    void addAggregatedFinalImagePointData();
+
     //! helper function to get the highest image point (the one with the largest value)
     int getHighestPtIndex() const;
 
@@ -309,6 +319,12 @@ namespace QCAD {
     std::vector<maxDimPt> vCoords;
     std::vector<maxDimPt> vGrads;
 
+    //! uniform grid of bins over vCoords, rebuilt whenever they are re-accumulated
+    double binSize;
+    double binOrigin[MAX_DIMENSIONS];
+    int nBins[MAX_DIMENSIONS];
+    std::vector<std::vector<std::size_t> > binPtIndices;
+
     //! data for level set method
     std::vector<double> vlsFieldValues;
     std::vector<double> vlsCellAreas;
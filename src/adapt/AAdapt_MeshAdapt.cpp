@@ -185,6 +185,9 @@ void AAdapt::MeshAdapt::beforeAdapt()
   TEUCHOS_FUNC_TIME_MONITOR("AlbanyAdapt: Transfer to APF Mesh");
   if (should_transfer_ip_data)
     pumi_discretization->attachQPData();
+  else
+    // drop the integration point output fields kept between writes
+    pumi_discretization->detachQPData();
   szField->preProcessOriginalMesh();
 }
 
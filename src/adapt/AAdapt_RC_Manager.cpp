@@ -179,6 +179,8 @@ public:
   void fillRhs(const PHX::MDField<const RealType>& f_G_qp, Manager::Field& f,
                const PHAL::Workset& workset, const BasisField& wbf);
   void project(Manager::Field& f);
+  // Project all fields with one solve of M_ against every column.
+  void project(const std::vector<Manager::Field*>& fs);
   void interp(const Manager::Field& f, const PHAL::Workset& workset,
               const BasisField& bf, Albany::MDArray& mda1,
               Albany::MDArray& mda2);
@@ -286,6 +288,10 @@ fillRhs (const PHX::MDField<const RealType>& f_G_qp, Manager::Field& f,
 }
 
 void Projector::project (Manager::Field& f) {
+  project(std::vector<Manager::Field*>(1, &f));
+}
+
+void Projector::project (const std::vector<Manager::Field*>& fs) {
   if ( ! M_->isFillComplete()) {
     // Export M_ so it has nonoverlapping rows and cols.
     M_->fillComplete();
@@ -296,33 +302,48 @@ void Projector::project (Manager::Field& f) {
     M->fillComplete();
     M_ = M;
   }
-  Teuchos::RCP<Tpetra_MultiVector> x[2];
-  for (int fi = 0; fi < f.num_g_fields; ++fi) {
-    const int nrhs = f.data_->mv[fi]->getNumVectors();
-    // Export the rhs to the same row map.
-    Teuchos::RCP<Tpetra_MultiVector>
-      b = Teuchos::rcp(new Tpetra_MultiVector(M_->getRangeMap(), nrhs, true));
-    b->doExport(*f.data_->mv[fi], *export_, Tpetra::ADD);
-    // Create x[fi] in M_ x[fi] = b[fi]. As a side effect, initialize P_ if
-    // necessary.
-    Teuchos::ParameterList pl;
-    pl.set("Block Size", 1); // Could be nrhs.
-    pl.set("Maximum Iterations", 1000);
-    pl.set("Convergence Tolerance", 1e-12);
-    pl.set("Output Frequency", 10);
-    pl.set("Output Style", 1);
-    pl.set("Verbosity", 0);//33);
-    x[fi] = solve(M_, P_, b, pl); // in AAdapt_RC_Projector_impl
-    // Import (reverse mode) to the overlapping MV.
-    f.data_->mv[fi]->putScalar(0);
-    f.data_->mv[fi]->doImport(*x[fi], *export_, Tpetra::ADD);
+  // Gather the rhs of every field and component into one multivector, so that
+  // M_ is applied and P_ is built and applied once for all of them.
+  int nrhs = 0;
+  for (std::size_t i = 0; i < fs.size(); ++i)
+    for (int fi = 0; fi < fs[i]->num_g_fields; ++fi)
+      nrhs += fs[i]->data_->mv[fi]->getNumVectors();
+  if (nrhs == 0) return;
+  // Export the rhs to the same row map.
+  Teuchos::RCP<Tpetra_MultiVector>
+    b = Teuchos::rcp(new Tpetra_MultiVector(M_->getRangeMap(), nrhs, true));
+  for (std::size_t i = 0, col = 0; i < fs.size(); ++i)
+    for (int fi = 0; fi < fs[i]->num_g_fields; ++fi) {
+      const Tpetra_MultiVector& mv = *fs[i]->data_->mv[fi];
+      const std::size_t ncol = mv.getNumVectors();
+      b->subViewNonConst(Teuchos::Range1D(col, col + ncol - 1))->doExport(
+        mv, *export_, Tpetra::ADD);
+      col += ncol;
+    }
+  // Create x in M_ x = b. As a side effect, initialize P_ if necessary.
+  Teuchos::ParameterList pl;
+  pl.set("Maximum Iterations", 1000);
+  pl.set("Convergence Tolerance", 1e-12);
+  pl.set("Output Frequency", 10);
+  pl.set("Output Style", 1);
+  pl.set("Verbosity", 0);//33);
+  Teuchos::RCP<Tpetra_MultiVector>
+    x = solve(M_, P_, b, pl); // in AAdapt_RC_Projector_impl
+  // Import (reverse mode) to the overlapping MVs.
+  for (std::size_t i = 0, col = 0; i < fs.size(); ++i)
+    for (int fi = 0; fi < fs[i]->num_g_fields; ++fi) {
+      Tpetra_MultiVector& mv = *fs[i]->data_->mv[fi];
+      const std::size_t ncol = mv.getNumVectors();
+      mv.putScalar(0);
+      mv.doImport(*x->subView(Teuchos::Range1D(col, col + ncol - 1)),
+                  *export_, Tpetra::ADD);
+      col += ncol;
+    }
 #if 0
-    amb::write_CrsMatrix("M", *M_);
-    amb::write_MultiVector("b", *b);
-    amb::write_MultiVector("x", *x[fi]);
-    amb::write_MultiVector("mv", *f.data_->mv[fi]);
+  amb::write_CrsMatrix("M", *M_);
+  amb::write_MultiVector("b", *b);
+  amb::write_MultiVector("x", *x);
 #endif
-  }
 }
 
 void Projector::
@@ -474,9 +495,11 @@ public:
         for (WsIdx wi = 0; wi < is_g_.size(); ++wi)
           transformStateArray(it->first, wi, Direction::G2g);
     else {
+      std::vector<Field*> fs;
       for (Map::iterator it = field_map_.begin(); it != field_map_.end();
            ++it)
-        proj_->project(*it->second);
+        fs.push_back(it->second.get());
+      proj_->project(fs);
     }
   }
 
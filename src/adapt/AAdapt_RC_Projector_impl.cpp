@@ -6,7 +6,7 @@
 
 #include "Albany_DataTypes.hpp"
 
-#include <BelosBlockCGSolMgr.hpp>
+#include <BelosPseudoBlockCGSolMgr.hpp>
 #include <BelosTpetraAdapter.hpp>
 #include <Ifpack2_RILUK.hpp>
 
@@ -43,7 +43,11 @@ solve (const Teuchos::RCP<const Tpetra_CrsMatrix>& A,
   problem->setRightPrec(P);
   problem->setProblem();
 
-  Belos::BlockCGSolMgr<RealType, MV, Op>
+  // The columns are often linearly dependent, e.g. the (i,j) and (j,i)
+  // components of a symmetric tensor, which breaks down true block CG. Pseudo
+  // block CG iterates each column separately but fuses the operator,
+  // preconditioner and reductions over all of them.
+  Belos::PseudoBlockCGSolMgr<RealType, MV, Op>
     solver(problem, Teuchos::rcp(&pl, false));
   solver.solve();
 
@@ -16,7 +16,8 @@ namespace rc {
  *  AAdapt_RC_Manager.cpp to build quickly.
  */
 
-//! Solve A x = b using preconditioner P. Construct P if it is null on input.
+//! Solve A x = b for all columns of b at once using preconditioner P.
+//! Construct P if it is null on input.
 Teuchos::RCP<Tpetra_MultiVector>
 solve(const Teuchos::RCP<const Tpetra_CrsMatrix>& A,
       Teuchos::RCP<Tpetra_Operator>& P,
@@ -77,6 +77,8 @@ bool SimAdapt::adaptMesh()
   bool should_transfer_ip_data = adapt_params_->get<bool>("Transfer IP Data", false);
   /* remove this assert when Simmetrix support IP transfer */
   assert(!should_transfer_ip_data);
+  /* drop the integration point output fields kept between writes */
+  sim_disc->detachQPData();
 
   /* grab the solution fields from the discretization.
      here we assume that the apf_ms->num_time_deriv = 0
@@ -458,6 +458,8 @@ bool SimLayerAdapt::adaptMesh()
   /* ensure that users don't expect Simmetrix to transfer IP state */
   bool should_transfer_ip_data = adapt_params_->get<bool>("Transfer IP Data", false);
   assert(!should_transfer_ip_data);
+  /* drop the integration point output fields kept between writes */
+  sim_disc->detachQPData();
 
   /* grab the solution / residual fields from the discretization.
      here we assume that the apf_ms->num_time_deriv = 0. */
@@ -29,6 +29,8 @@
 
 #include <apfMesh.h>
 #include <apfShape.h>
+#include <apfField.h>
+#include <apfFieldData.h>
 #include <PCU.h>
 
 #if defined(ALBANY_CONTACT)
@@ -1295,17 +1297,21 @@ void Albany::APFDiscretization::computeSideSets()
   m->end(it);
 }
 
+// The QP copies move all the points of an entity with a single call into
+// the field data; apf stores scalar, vector and matrix fields with 1, 3 and
+// 9 components per point regardless of the problem dimension.
+
 void Albany::APFDiscretization::copyQPScalarToAPF(
     unsigned nqp,
     std::string const& stateName,
     apf::Field* f)
 {
+  apf::FieldDataOf<double>* data = f->getData();
   for (std::size_t b=0; b < buckets.size(); ++b) {
     std::vector<apf::MeshEntity*>& buck = buckets[b];
     Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
     for (std::size_t e=0; e < buck.size(); ++e)
-      for (std::size_t p=0; p < nqp; ++p)
-        apf::setScalar(f,buck[e],p,ar(e,p));
+      data->setNodeComponents(buck[e], &ar(e,0));
   }
 }
 
@@ -1315,16 +1321,16 @@ void Albany::APFDiscretization::copyQPVectorToAPF(
     apf::Field* f)
 {
   const int spdim = meshStruct->problemDim;
-  apf::Vector3 v(0,0,0);
+  apf::FieldDataOf<double>* data = f->getData();
+  std::vector<double> buf(nqp*3, 0.0);
   for (std::size_t b=0; b < buckets.size(); ++b) {
     std::vector<apf::MeshEntity*>& buck = buckets[b];
     Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
     for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
+      for (std::size_t p=0; p < nqp; ++p)
         for (std::size_t i=0; i < spdim; ++i)
-          v[i] = ar(e,p,i);
-        apf::setVector(f,buck[e],p,v);
-      }
+          buf[p*3 + i] = ar(e,p,i);
+      data->setNodeComponents(buck[e], &buf[0]);
     }
   }
 }
@@ -1335,21 +1341,37 @@ void Albany::APFDiscretization::copyQPTensorToAPF(
     apf::Field* f)
 {
   const int spdim = meshStruct->problemDim;
-  apf::Matrix3x3 v(0,0,0,0,0,0,0,0,0);
+  apf::FieldDataOf<double>* data = f->getData();
+  std::vector<double> buf(nqp*9, 0.0);
   for (std::size_t b=0; b < buckets.size(); ++b) {
     std::vector<apf::MeshEntity*>& buck = buckets[b];
     Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
     for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
+      for (std::size_t p=0; p < nqp; ++p)
         for (std::size_t i=0; i < spdim; ++i)
           for (std::size_t j=0; j < spdim; ++j)
-            v[i][j] = ar(e,p,i,j);
-        apf::setMatrix(f,buck[e],p,v);
-      }
+            buf[p*9 + i*3 + j] = ar(e,p,i,j);
+      data->setNodeComponents(buck[e], &buf[0]);
     }
   }
 }
 
+// Return the field for a QP state, reusing the one left on the mesh by a
+// previous copy when it has the requested shape
+static apf::Field* getQPField(
+    apf::Mesh2* m,
+    std::string const& name,
+    int valueType,
+    apf::FieldShape* fs)
+{
+  apf::Field* f = m->findField(name.c_str());
+  if (f && (apf::getShape(f) == fs) && (apf::getValueType(f) == valueType))
+    return f;
+  if (f)
+    apf::destroyField(f);
+  return apf::createField(m, name.c_str(), valueType, fs);
+}
+
 void Albany::APFDiscretization::copyQPStatesToAPF(
     apf::Field* f,
     apf::FieldShape* fs,
@@ -1361,7 +1383,7 @@ void Albany::APFDiscretization::copyQPStatesToAPF(
     if (!copyAll && !state.output)
       continue;
     int nqp = state.dims[1];
-    f = apf::createField(m,state.name.c_str(),apf::SCALAR,fs);
+    f = getQPField(m,state.name,apf::SCALAR,fs);
     copyQPScalarToAPF(nqp, state.name, f);
   }
   for (std::size_t i=0; i < meshStruct->qpvector_states.size(); ++i) {
@@ -1369,7 +1391,7 @@ void Albany::APFDiscretization::copyQPStatesToAPF(
     if (!copyAll && !state.output)
       continue;
     int nqp = state.dims[1];
-    f = apf::createField(m,state.name.c_str(),apf::VECTOR,fs);
+    f = getQPField(m,state.name,apf::VECTOR,fs);
     copyQPVectorToAPF(nqp, state.name, f);
   }
   for (std::size_t i=0; i < meshStruct->qptensor_states.size(); ++i) {
@@ -1377,27 +1399,43 @@ void Albany::APFDiscretization::copyQPStatesToAPF(
     if (!copyAll && !state.output)
       continue;
     int nqp = state.dims[1];
-    f = apf::createField(m,state.name.c_str(),apf::MATRIX,fs);
+    f = getQPField(m,state.name,apf::MATRIX,fs);
     copyQPTensorToAPF(nqp, state.name, f);
   }
   if (meshStruct->saveStabilizedStress)
     saveStabilizedStress();
 }
 
-void Albany::APFDiscretization::removeQPStatesFromAPF()
+// Output fields (integration point shape, output states) are kept on the
+// mesh so the next output reuses them, unless keepOutput is false;
+// everything else is destroyed, in particular the fields attached for
+// adaptation.
+static void removeQPField(
+    apf::Mesh2* m,
+    std::string const& name,
+    bool keep,
+    apf::FieldShape* outputShape)
+{
+  apf::Field* f = m->findField(name.c_str());
+  if (f && (!keep || apf::getShape(f) != outputShape))
+    apf::destroyField(f);
+}
+
+void Albany::APFDiscretization::removeQPStatesFromAPF(bool keepOutput)
 {
   apf::Mesh2* m = meshStruct->getMesh();
+  apf::FieldShape* fs = apf::getIPShape(getNumDim(), meshStruct->cubatureDegree);
   for (std::size_t i=0; i < meshStruct->qpscalar_states.size(); ++i) {
     PUMIQPData<double, 2>& state = *(meshStruct->qpscalar_states[i]);
-    apf::destroyField(m->findField(state.name.c_str()));
+    removeQPField(m, state.name, keepOutput && state.output, fs);
   }
   for (std::size_t i=0; i < meshStruct->qpvector_states.size(); ++i) {
     PUMIQPData<double, 3>& state = *(meshStruct->qpvector_states[i]);
-    apf::destroyField(m->findField(state.name.c_str()));
+    removeQPField(m, state.name, keepOutput && state.output, fs);
   }
   for (std::size_t i=0; i < meshStruct->qptensor_states.size(); ++i) {
     PUMIQPData<double, 4>& state = *(meshStruct->qptensor_states[i]);
-    apf::destroyField(m->findField(state.name.c_str()));
+    removeQPField(m, state.name, keepOutput && state.output, fs);
   }
 }
 
@@ -1406,15 +1444,12 @@ void Albany::APFDiscretization::copyQPScalarFromAPF(
     std::string const& stateName,
     apf::Field* f)
 {
-  apf::Mesh2* m = meshStruct->getMesh();
+  apf::FieldDataOf<double>* data = f->getData();
   for (std::size_t b=0; b < buckets.size(); ++b) {
     std::vector<apf::MeshEntity*>& buck = buckets[b];
     Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p = 0; p < nqp; ++p) {
-        ar(e,p) = apf::getScalar(f,buck[e],p);
-      }
-    }
+    for (std::size_t e=0; e < buck.size(); ++e)
+      data->getNodeComponents(buck[e], &ar(e,0));
   }
 }
 
@@ -1424,17 +1459,16 @@ void Albany::APFDiscretization::copyQPVectorFromAPF(
     apf::Field* f)
 {
   const int spdim = meshStruct->problemDim;
-  apf::Mesh2* m = meshStruct->getMesh();
-  apf::Vector3 v(0,0,0);
+  apf::FieldDataOf<double>* data = f->getData();
+  std::vector<double> buf(nqp*3);
   for (std::size_t b=0; b < buckets.size(); ++b) {
     std::vector<apf::MeshEntity*>& buck = buckets[b];
     Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
     for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        apf::getVector(f,buck[e],p,v);
+      data->getNodeComponents(buck[e], &buf[0]);
+      for (std::size_t p=0; p < nqp; ++p)
         for (std::size_t i=0; i < spdim; ++i)
-          ar(e,p,i) = v[i];
-      }
+          ar(e,p,i) = buf[p*3 + i];
     }
   }
 }
@@ -1445,19 +1479,17 @@ void Albany::APFDiscretization::copyQPTensorFromAPF(
     apf::Field* f)
 {
   const int spdim = meshStruct->problemDim;
-  apf::Mesh2* m = meshStruct->getMesh();
-  apf::Matrix3x3 v(0,0,0,0,0,0,0,0,0);
+  apf::FieldDataOf<double>* data = f->getData();
+  std::vector<double> buf(nqp*9);
   for (std::size_t b = 0; b < buckets.size(); ++b) {
     std::vector<apf::MeshEntity*>& buck = buckets[b];
     Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
     for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        apf::getMatrix(f,buck[e],p,v);
-        for (std::size_t i=0; i < spdim; ++i) {
+      data->getNodeComponents(buck[e], &buf[0]);
+      for (std::size_t p=0; p < nqp; ++p)
+        for (std::size_t i=0; i < spdim; ++i)
           for (std::size_t j=0; j < spdim; ++j)
-            ar(e,p,i,j) = v[i][j];
-        }
-      }
+            ar(e,p,i,j) = buf[p*9 + i*3 + j];
     }
   }
 }
@@ -1611,9 +1643,11 @@ Albany::APFDiscretization::attachQPData() {
   copyQPStatesToAPF(f,fs);
 }
 
+// Also drops the output fields kept from the last write: the mesh
+// adapters cannot carry integration point fields through a modification.
 void
 Albany::APFDiscretization::detachQPData() {
-  removeQPStatesFromAPF();
+  removeQPStatesFromAPF(false);
 }
 
 static apf::Field* interpolate(
@@ -1685,6 +1719,11 @@ Albany::APFDiscretization::initTemperatureHack() {
   if (!meshStruct->useTemperatureHack)
     return;
   apf::Mesh* m = meshStruct->getMesh();
+  // drop output fields of the same name kept from a previous write
+  if (m->findField("Temperature"))
+    apf::destroyField(m->findField("Temperature"));
+  if (m->findField("Temperature_old"))
+    apf::destroyField(m->findField("Temperature_old"));
   temperaturesToQP(m, meshStruct->cubatureDegree);
   copyQPStatesFromAPF();
   apf::destroyField(m->findField("Temperature"));
@@ -369,7 +369,7 @@ class APFDiscretization : public Albany::AbstractDiscretization {
     void copyQPVectorToAPF(unsigned nqp, std::string const& state, apf::Field* f);
     void copyQPTensorToAPF(unsigned nqp, std::string const& state, apf::Field* f);
     void copyQPStatesToAPF(apf::Field* f, apf::FieldShape* fs, bool copyAll = true);
-    void removeQPStatesFromAPF();
+    void removeQPStatesFromAPF(bool keepOutput = true);
 
     //! Transfer QP Fields from APF to PUMIQPData
     void copyQPScalarFromAPF(unsigned nqp, std::string const& stateName, apf::Field* f);
@@ -5,7 +5,13 @@
 //*****************************************************************//
 
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <map>
 
 #include "Albany_GmshSTKMeshStruct.hpp"
 #include "Teuchos_VerboseObject.hpp"
@@ -20,6 +26,7 @@
 #include <stk_mesh/base/Selector.hpp>
 
 #include <Albany_STKNodeSharing.hpp>
+#include <stk_util/parallel/CommSparse.hpp>
 
 #ifdef ALBANY_SEACAS
 #include <stk_io/IossBridge.hpp>
@@ -38,12 +45,14 @@ Albany::GmshSTKMeshStruct::GmshSTKMeshStruct (const Teuchos::RCP<Teuchos::Parame
 
   // Init counters to 0
   NumSides = NumNodes = NumSides = 0;
+  NumLocalElems = firstLocalElem = 0;
 
   // Init ptrs to nullptr
   pts = nullptr;
   tetra = hexas = trias = quads = lines = nullptr;
 
-  // Reading the mesh on proc 0
+  // Reading the file format on proc 0
+  int format[3] = {0, 0, 0}; // legacy, binary, version times 10
   if (commT->getRank() == 0) {
     std::ifstream ifile;
     ifile.open(fname.c_str());
@@ -56,6 +65,7 @@ Albany::GmshSTKMeshStruct::GmshSTKMeshStruct (const Teuchos::RCP<Teuchos::Parame
 
     bool legacy = false;
     bool binary = false;
+    float version = 0;
 
     if (line=="$NOD") {
       legacy = true;
@@ -63,7 +73,6 @@ Albany::GmshSTKMeshStruct::GmshSTKMeshStruct (const Teuchos::RCP<Teuchos::Parame
       std::getline (ifile, line);
       std::stringstream iss (line);
 
-      float version;
       int doublesize;
       iss >> version >> binary >> doublesize;
     } else {
@@ -71,9 +80,25 @@ Albany::GmshSTKMeshStruct::GmshSTKMeshStruct (const Teuchos::RCP<Teuchos::Parame
     }
     ifile.close();
 
-    if (legacy) {
+    format[0] = legacy;
+    format[1] = binary;
+    format[2] = static_cast<int>(10*version+0.5);
+  }
+  Teuchos::broadcast(*commT, 0, 3, format);
+
+  // Binary files have fixed size records, so every rank can read its own part
+  parallelRead = params->get("Gmsh Parallel Read", false) && format[1] && !format[0];
+  TEUCHOS_TEST_FOR_EXCEPTION (parallelRead && format[2]/10!=2 && format[2]!=41, std::runtime_error,
+      "Error! Parallel read only supports the Gmsh binary formats 2 and 4.1.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (!parallelRead && format[2]>=40, std::runtime_error,
+      "Error! The Gmsh format 4 is only supported by a parallel read of a binary file.\n");
+
+  if (parallelRead) {
+    loadBinaryMeshParallel (fname, format[2], commT);
+  } else if (commT->getRank() == 0) {
+    if (format[0]) {
       loadLegacyMesh (fname);
-    } else if (binary) {
+    } else if (format[1]) {
       loadBinaryMesh (fname);
     } else {
       loadAsciiMesh (fname);
@@ -122,10 +147,14 @@ Albany::GmshSTKMeshStruct::GmshSTKMeshStruct (const Teuchos::RCP<Teuchos::Parame
   stk::io::put_io_part_attribute(metaData->universal_part());
 #endif
 
-  // Counting boundaries (only proc 0 has any stored, so far)
+  // Counting boundaries (only proc 0 has any stored, so far, unless reading in parallel)
   std::set<int> bdTags;
-  for (int i(0); i<NumSides; ++i) {
-    bdTags.insert(sides[NumSideNodes][i]);
+  if (parallelRead) {
+    bdTags = allSideTags;
+  } else {
+    for (int i(0); i<NumSides; ++i) {
+      bdTags.insert(sides[NumSideNodes][i]);
+    }
   }
 
   // Broadcasting the tags
@@ -263,8 +292,8 @@ void Albany::GmshSTKMeshStruct::setFieldAndBulkData(
 
   bulkData->modification_begin(); // Begin modifying the mesh
 
-  // Only proc 0 has loaded the file
-  if (commT->getRank()==0) {
+  // Only proc 0 has loaded the file, unless it was read in parallel
+  if (parallelRead || commT->getRank()==0) {
     stk::mesh::PartVector singlePartVec(1);
     unsigned int ebNo = 0; //element block #???
     int sideID = 0;
@@ -275,7 +304,8 @@ void Albany::GmshSTKMeshStruct::setFieldAndBulkData(
     singlePartVec[0] = nsPartVec["Node"];
 
     for (int i = 0; i < NumNodes; i++) {
-      stk::mesh::Entity node = bulkData->declare_entity(stk::topology::NODE_RANK, i + 1, singlePartVec);
+      const int node_id = parallelRead ? localNodeGIDs[i] : i + 1;
+      stk::mesh::Entity node = bulkData->declare_entity(stk::topology::NODE_RANK, node_id, singlePartVec);
 
       double* coord;
       coord = stk::mesh::field_data(*coordinates_field, node);
@@ -285,9 +315,10 @@ void Albany::GmshSTKMeshStruct::setFieldAndBulkData(
         coord[2] = pts[i][2];
     }
 
-    for (int i = 0; i < NumElems; i++) {
+    const int numLocalElems = parallelRead ? NumLocalElems : NumElems;
+    for (int i = 0; i < numLocalElems; i++) {
       singlePartVec[0] = partVec[ebNo];
-      stk::mesh::Entity elem = bulkData->declare_entity(stk::topology::ELEMENT_RANK, i + 1, singlePartVec);
+      stk::mesh::Entity elem = bulkData->declare_entity(stk::topology::ELEMENT_RANK, firstLocalElem + i + 1, singlePartVec);
 
       for (int j = 0; j < NumElemNodes; j++) {
         stk::mesh::Entity node = bulkData->get_entity(stk::topology::NODE_RANK, elems[j][i]);
@@ -302,19 +333,11 @@ void Albany::GmshSTKMeshStruct::setFieldAndBulkData(
     stk::mesh::PartVector nsPartVec_i(1), ssPartVec_i(2);
     ssPartVec_i[0] = ssPartVec["BoundarySide"]; // The whole boundary side
     for (int i = 0; i < NumSides; i++) {
+      // We have to find out what element has this side as a side. We check the node connectivity
+      // In particular, the element that is connected to all NumSideNodes nodes is the one.
       std::map<int,int> elm_count;
-      partName = bdTagToNodeSetName[sides[NumSideNodes][i]];
-      nsPartVec_i[0] = nsPartVec[partName];
-
-      partName = bdTagToSideSetName[sides[NumSideNodes][i]];
-      ssPartVec_i[1] = ssPartVec[partName];
-
-      stk::mesh::Entity side = bulkData->declare_entity(metaData->side_rank(), i + 1, ssPartVec_i);
       for (int j=0; j<NumSideNodes; ++j) {
         stk::mesh::Entity node_j = bulkData->get_entity(stk::topology::NODE_RANK,sides[j][i]);
-        bulkData->change_entity_parts (node_j,nsPartVec_i); // Add node to the boundary nodeset
-        bulkData->declare_relation(side, node_j, j);
-
         int num_e = bulkData->num_elements(node_j);
         const stk::mesh::Entity* e = bulkData->begin_elements(node_j);
         for (int k(0); k<num_e; ++k) {
@@ -322,29 +345,58 @@ void Albany::GmshSTKMeshStruct::setFieldAndBulkData(
         }
       }
 
-      // We have to find out what element has this side as a side. We check the node connectivity
-      // In particular, the element that is connected to all NumSideNodes nodes is the one.
+      stk::mesh::Entity elem;
       bool found = false;
-
       for (auto e : elm_count)
         if (e.second==NumSideNodes)
         {
-          stk::mesh::Entity elem = bulkData->get_entity(stk::topology::ELEM_RANK, e.first);
+          elem = bulkData->get_entity(stk::topology::ELEM_RANK, e.first);
           found = true;
-          int num_sides = bulkData->num_sides(elem);
-          bulkData->declare_relation(elem,side,num_sides);
           break;
         }
 
+      // With a parallel read, the side may belong to an element on another rank
+      if (!found && parallelRead)
+        continue;
+
       TEUCHOS_TEST_FOR_EXCEPTION (found==false, std::logic_error, "Error! Cannot find element connected to side " << i+1 << ".\n");
+
+      partName = bdTagToNodeSetName[sides[NumSideNodes][i]];
+      nsPartVec_i[0] = nsPartVec[partName];
+
+      partName = bdTagToSideSetName[sides[NumSideNodes][i]];
+      ssPartVec_i[1] = ssPartVec[partName];
+
+      const int side_id = parallelRead ? localSideGIDs[i] : i + 1;
+      stk::mesh::Entity side = bulkData->declare_entity(metaData->side_rank(), side_id, ssPartVec_i);
+      for (int j=0; j<NumSideNodes; ++j) {
+        stk::mesh::Entity node_j = bulkData->get_entity(stk::topology::NODE_RANK,sides[j][i]);
+        bulkData->change_entity_parts (node_j,nsPartVec_i); // Add node to the boundary nodeset
+        bulkData->declare_relation(side, node_j, j);
+      }
+
+      int num_sides = bulkData->num_sides(elem);
+      bulkData->declare_relation(elem,side,num_sides);
     }
 
   }
+
+  // Nodes read by several ranks must be marked as shared
+  if (parallelRead)
+    Albany::fix_node_sharing(*bulkData);
+
   bulkData->modification_end();
 
 #ifdef ALBANY_ZOLTAN
-  // Gmsh is for sure using a serial mesh. We hard code it here, in case the user did not set it
-  params->set<bool>("Use Serial Mesh", true);
+  if (parallelRead) {
+    // Each rank holds a contiguous range of elements: rebalance by default
+    params->set<bool>("Use Serial Mesh", false);
+    if (!params->isParameter("Rebalance Mesh"))
+      params->set<bool>("Rebalance Mesh", true);
+  } else {
+    // Gmsh is for sure using a serial mesh. We hard code it here, in case the user did not set it
+    params->set<bool>("Use Serial Mesh", true);
+  }
 
   // Refine the mesh before starting the simulation if indicated
   uniformRefineMesh(commT);
@@ -370,6 +422,8 @@ Teuchos::RCP<const Teuchos::ParameterList> Albany::GmshSTKMeshStruct::getValidDi
   Teuchos::RCP<Teuchos::ParameterList> validPL = this->getValidGenericSTKParameters("Valid ASCII_DiscParams");
   validPL->set<std::string>("Gmsh Input Mesh File Name", "mesh.msh",
       "Name of the file containing the 2D mesh, with list of coordinates, elements' connectivity and boundary edges' connectivity");
+  validPL->set<bool>("Gmsh Parallel Read", false,
+      "Read a binary (version 2 or 4.1) mesh file in parallel, each rank reading a range of elements and sides");
 
   return validPL;
 }
@@ -1006,3 +1060,543 @@ void Albany::GmshSTKMeshStruct::loadBinaryMesh (const std::string& fname)
   // Close the input stream
   ifile.close();
 }
+
+namespace {
+
+// Layout of a binary Gmsh file, found by rank 0 and broadcast to all ranks.
+// Integers are 4 bytes in format 2 and 8 bytes (size_t) in format 4.1.
+struct GmshNodeBlock {
+  long long tag_offset;   // Offset of the first node tag
+  long long tag_stride;   // Bytes between two node tags
+  long long xyz_offset;   // Offset of the first coordinates
+  long long xyz_stride;   // Bytes between two coordinate triples
+  long long first_tag;    // Tag of the first node; tags are contiguous in a block
+  long long count;
+};
+
+struct GmshElemBlock {
+  long long offset;       // Offset of the first record
+  long long type;         // Gmsh element type
+  long long count;
+  long long rec_len;      // Integers per record
+  long long node_pos;     // Position of the first node in a record
+  long long tag_pos;      // Position of the physical tag in a record, or -1...
+  long long tag;          // ...in which case this is the tag of the whole block
+};
+
+struct GmshLayout {
+  int int_size;
+  std::vector<GmshNodeBlock> nodes;
+  std::vector<GmshElemBlock> elems;
+};
+
+int gmshNumPoints (const long long type)
+{
+  switch (type) {
+    case 1:  return 2; // 2-pt Line
+    case 2:  return 3; // 3-pt Triangle
+    case 3:  return 4; // 4-pt Quad
+    case 4:  return 4; // 4-pt Tetra
+    case 5:  return 8; // 8-pt Hexa
+    case 15: return 1; // Point
+  }
+  TEUCHOS_TEST_FOR_EXCEPTION (true, Teuchos::Exceptions::InvalidParameter, "Error! Element type not supported.\n");
+  return 0;
+}
+
+template<typename T>
+T readBinary (std::ifstream& ifile)
+{
+  T val;
+  ifile.read (reinterpret_cast<char*> (&val), sizeof(T));
+  return val;
+}
+
+// Read n integers of int_size bytes, stride bytes apart, starting at offset
+void readGmshInts (std::ifstream& ifile, const long long offset, const long long n,
+                   const int int_size, const long long stride, std::vector<long long>& out)
+{
+  out.resize(n);
+  if (n==0) return;
+
+  std::vector<char> buf ((n-1)*stride + int_size);
+  ifile.seekg (offset, std::ios::beg);
+  ifile.read (&buf[0], buf.size());
+  for (long long i=0; i<n; ++i) {
+    if (int_size==sizeof(int)) {
+      int val;
+      std::memcpy (&val, &buf[i*stride], sizeof(int));
+      out[i] = val;
+    } else {
+      std::memcpy (&out[i], &buf[i*stride], sizeof(long long));
+    }
+  }
+}
+
+void scanGmshBinary2 (std::ifstream& ifile, GmshLayout& layout)
+{
+  layout.int_size = sizeof(int);
+
+  std::string line;
+  while (std::getline (ifile, line) && line != "$Nodes") {
+    // Keep swallowing lines...
+  }
+  TEUCHOS_TEST_FOR_EXCEPTION (ifile.eof(), std::runtime_error, "Error! Nodes section not found.\n");
+
+  // One block of records made of the node id and its coordinates
+  std::getline (ifile, line);
+  GmshNodeBlock nb;
+  nb.count = std::atoll (line.c_str() );
+  TEUCHOS_TEST_FOR_EXCEPTION (nb.count<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of nodes.\n");
+  nb.tag_offset = ifile.tellg();
+  nb.tag_stride = sizeof(int)+3*sizeof(double);
+  nb.xyz_offset = nb.tag_offset + sizeof(int);
+  nb.xyz_stride = nb.tag_stride;
+  nb.first_tag  = 1;
+  layout.nodes.push_back(nb);
+  ifile.seekg (nb.count*nb.tag_stride, std::ios::cur);
+
+  while (std::getline (ifile, line) && line != "$Elements") {
+    // Keep swallowing lines...
+  }
+  TEUCHOS_TEST_FOR_EXCEPTION (ifile.eof(), std::runtime_error, "Error! Element section not found.\n");
+
+  std::getline (ifile, line);
+  int num_entities = std::atoi (line.c_str() );
+  TEUCHOS_TEST_FOR_EXCEPTION (num_entities<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of mesh elements.\n");
+
+  // Blocks of records made of the element id, its tags (the first is the physical tag) and its nodes
+  int entities_found = 0;
+  while (entities_found<num_entities) {
+    int header[3]; // type, number of elements, number of tags
+    ifile.read(reinterpret_cast<char*> (header), 3*sizeof(int));
+
+    TEUCHOS_TEST_FOR_EXCEPTION (header[1]<=0, std::logic_error, "Error! Invalid number of elements of this type.\n");
+    TEUCHOS_TEST_FOR_EXCEPTION (header[2]<=0, std::logic_error, "Error! Invalid number of tags.\n");
+
+    GmshElemBlock eb;
+    eb.offset   = ifile.tellg();
+    eb.type     = header[0];
+    eb.count    = header[1];
+    eb.rec_len  = 1+header[2]+gmshNumPoints(header[0]);
+    eb.node_pos = 1+header[2];
+    eb.tag_pos  = 1;
+    eb.tag      = 0;
+    layout.elems.push_back(eb);
+
+    entities_found += header[1];
+    ifile.seekg (eb.count*eb.rec_len*sizeof(int), std::ios::cur);
+  }
+}
+
+void scanGmshBinary41 (std::ifstream& ifile, GmshLayout& layout)
+{
+  layout.int_size = sizeof(long long);
+
+  // Physical tag of each entity (dimension, tag); elements only know their entity
+  std::map<std::pair<int,int>,int> physical;
+
+  bool nodes_found = false;
+  bool elems_found = false;
+  std::string line;
+  while (!elems_found && std::getline (ifile, line)) {
+    if (line=="$Entities") {
+      long long num[4]; // points, curves, surfaces, volumes
+      ifile.read (reinterpret_cast<char*> (num), 4*sizeof(long long));
+      for (int dim=0; dim<4; ++dim) {
+        for (long long e=0; e<num[dim]; ++e) {
+          const int tag = readBinary<int>(ifile);
+          ifile.seekg ((dim==0 ? 3 : 6)*sizeof(double), std::ios::cur); // Point or bounding box
+          const long long num_phys = readBinary<long long>(ifile);
+          std::vector<int> phys (num_phys);
+          if (num_phys>0)
+            ifile.read (reinterpret_cast<char*> (&phys[0]), num_phys*sizeof(int));
+          physical[std::make_pair(dim,tag)] = num_phys>0 ? phys[0] : 0; // Use first tag
+          if (dim>0) {
+            const long long num_bounds = readBinary<long long>(ifile);
+            ifile.seekg (num_bounds*sizeof(int), std::ios::cur);
+          }
+        }
+      }
+    } else if (line=="$PartitionedEntities") {
+      TEUCHOS_TEST_FOR_EXCEPTION (true, std::runtime_error, "Error! Partitioned Gmsh files are not supported.\n");
+    } else if (line=="$Nodes") {
+      long long header[4]; // blocks, nodes, min tag, max tag
+      ifile.read (reinterpret_cast<char*> (header), 4*sizeof(long long));
+      TEUCHOS_TEST_FOR_EXCEPTION (header[1]<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of nodes.\n");
+
+      // Each block holds all the node tags, then all the coordinates
+      for (long long b=0; b<header[0]; ++b) {
+        int info[3]; // entity dimension, entity tag, parametric
+        ifile.read (reinterpret_cast<char*> (info), 3*sizeof(int));
+        TEUCHOS_TEST_FOR_EXCEPTION (info[2]!=0, std::runtime_error, "Error! Parametric nodes are not supported.\n");
+
+        GmshNodeBlock nb;
+        nb.count      = readBinary<long long>(ifile);
+        nb.tag_offset = ifile.tellg();
+        nb.tag_stride = sizeof(long long);
+        nb.xyz_offset = nb.tag_offset + nb.count*nb.tag_stride;
+        nb.xyz_stride = 3*sizeof(double);
+        if (nb.count>0) {
+          nb.first_tag = readBinary<long long>(ifile);
+          layout.nodes.push_back(nb);
+        }
+        ifile.seekg (nb.xyz_offset + nb.count*nb.xyz_stride, std::ios::beg);
+      }
+      nodes_found = true;
+    } else if (line=="$Elements") {
+      long long header[4]; // blocks, elements, min tag, max tag
+      ifile.read (reinterpret_cast<char*> (header), 4*sizeof(long long));
+      TEUCHOS_TEST_FOR_EXCEPTION (header[1]<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of mesh elements.\n");
+
+      // Blocks of records made of the element tag and its nodes
+      for (long long b=0; b<header[0]; ++b) {
+        int info[3]; // entity dimension, entity tag, type
+        ifile.read (reinterpret_cast<char*> (info), 3*sizeof(int));
+
+        GmshElemBlock eb;
+        eb.count    = readBinary<long long>(ifile);
+        eb.offset   = ifile.tellg();
+        eb.type     = info[2];
+        eb.rec_len  = 1+gmshNumPoints(info[2]);
+        eb.node_pos = 1;
+        eb.tag_pos  = -1;
+        auto it = physical.find(std::make_pair(info[0],info[1]));
+        eb.tag      = it!=physical.end() ? it->second : 0;
+        if (eb.count>0)
+          layout.elems.push_back(eb);
+        ifile.seekg (eb.count*eb.rec_len*sizeof(long long), std::ios::cur);
+      }
+      elems_found = true;
+    }
+  }
+  TEUCHOS_TEST_FOR_EXCEPTION (!nodes_found, std::runtime_error, "Error! Nodes section not found.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (!elems_found, std::runtime_error, "Error! Element section not found.\n");
+}
+
+// Send send[p] to every rank p, and return what all ranks sent to this one
+std::vector<int> exchangeInts (stk::ParallelMachine comm, const int rank,
+                               const std::vector<std::vector<int> >& send)
+{
+  const int size = send.size();
+  stk::CommSparse sparse (comm);
+  for (int phase=0; phase<2; ++phase) {
+    for (int p=0; p<size; ++p) {
+      if (p==rank) continue;
+      for (int val : send[p])
+        sparse.send_buffer(p).pack<int>(val);
+    }
+    if (phase==0) {
+      sparse.allocate_buffers();
+    } else {
+      sparse.communicate();
+    }
+  }
+
+  std::vector<int> recv (send[rank]);
+  for (int p=0; p<size; ++p) {
+    if (p==rank) continue;
+    while (sparse.recv_buffer(p).remaining()) {
+      int val;
+      sparse.recv_buffer(p).unpack<int>(val);
+      recv.push_back(val);
+    }
+  }
+  return recv;
+}
+
+} // namespace
+
+void Albany::GmshSTKMeshStruct::loadBinaryMeshParallel (const std::string& fname, const int version,
+                                                        const Teuchos::RCP<const Teuchos_Comm>& commT)
+{
+  // Rank 0 scans the section headers, seeking over the records, and broadcasts the layout
+  std::vector<long long> packed;
+  if (commT->getRank()==0) {
+    std::ifstream ifile;
+    ifile.open(fname.c_str(), std::ios::binary);
+    if (!ifile.is_open()) {
+        TEUCHOS_TEST_FOR_EXCEPTION(true, std::runtime_error, "Error! Cannot open mesh file '" << fname << "'.\n");
+    }
+
+    std::string line;
+    std::getline (ifile, line); // $MeshFormat
+    std::getline (ifile, line); // version file-type data-size
+
+    // Check file endianness
+    int one;
+    ifile.read (reinterpret_cast<char*> (&one), sizeof (int) );
+    TEUCHOS_TEST_FOR_EXCEPTION (one!=1, std::runtime_error, "Error! Uncompatible binary format.\n");
+
+    GmshLayout layout;
+    if (version==41) {
+      scanGmshBinary41 (ifile, layout);
+    } else {
+      scanGmshBinary2 (ifile, layout);
+    }
+    ifile.close();
+
+    packed.push_back (layout.int_size);
+    packed.push_back (layout.nodes.size());
+    for (const auto& nb : layout.nodes) {
+      const long long vals[6] = {nb.tag_offset, nb.tag_stride, nb.xyz_offset, nb.xyz_stride, nb.first_tag, nb.count};
+      packed.insert (packed.end(), vals, vals+6);
+    }
+    packed.push_back (layout.elems.size());
+    for (const auto& eb : layout.elems) {
+      const long long vals[7] = {eb.offset, eb.type, eb.count, eb.rec_len, eb.node_pos, eb.tag_pos, eb.tag};
+      packed.insert (packed.end(), vals, vals+7);
+    }
+  }
+
+  int packed_size = packed.size();
+  Teuchos::broadcast<int,int>(*commT, 0, 1, &packed_size);
+  packed.resize(packed_size);
+  Teuchos::broadcast<int,long long>(*commT, 0, packed_size, &packed[0]);
+
+  GmshLayout layout;
+  const long long* pos = &packed[0];
+  layout.int_size = *pos++;
+  layout.nodes.resize(*pos++);
+  for (auto& nb : layout.nodes) {
+    nb.tag_offset = *pos++; nb.tag_stride = *pos++; nb.xyz_offset = *pos++;
+    nb.xyz_stride = *pos++; nb.first_tag  = *pos++; nb.count      = *pos++;
+  }
+  layout.elems.resize(*pos++);
+  for (auto& eb : layout.elems) {
+    eb.offset   = *pos++; eb.type    = *pos++; eb.count = *pos++; eb.rec_len = *pos++;
+    eb.node_pos = *pos++; eb.tag_pos = *pos++; eb.tag   = *pos++;
+  }
+  const int int_size = layout.int_size;
+
+  // Establish what kind of elements we have, as in the serial readers
+  long long nb[16] = {0};
+  for (const auto& eb : layout.elems) {
+    nb[eb.type] += eb.count;
+  }
+  TEUCHOS_TEST_FOR_EXCEPTION (nb[4]*nb[5]!=0, std::logic_error, "Error! Cannot mix tetrahedra and hexahedra.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (nb[2]*nb[3]!=0, std::logic_error, "Error! Cannot mix triangles and quadrilaterals.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (nb[4]+nb[5]+nb[2]+nb[3]==0, std::logic_error, "Error! Can only handle 2D and 3D geometries.\n");
+
+  int elem_type, side_type;
+  if (nb[4]>0) {
+    this->numDim = 3; elem_type = 4; side_type = 2; NumElemNodes = 4; NumSideNodes = 3;
+  } else if (nb[5]>0) {
+    this->numDim = 3; elem_type = 5; side_type = 3; NumElemNodes = 8; NumSideNodes = 4;
+  } else if (nb[2]>0) {
+    this->numDim = 2; elem_type = 2; side_type = 1; NumElemNodes = 3; NumSideNodes = 2;
+  } else {
+    this->numDim = 2; elem_type = 3; side_type = 1; NumElemNodes = 4; NumSideNodes = 2;
+  }
+  NumElems = nb[elem_type];
+
+  // This rank's contiguous range of elements, and of sides
+  const int rank = commT->getRank();
+  const int size = commT->getSize();
+  const long long elem_begin = (static_cast<long long>(NumElems)*rank)/size;
+  const long long elem_end   = (static_cast<long long>(NumElems)*(rank+1))/size;
+  firstLocalElem = elem_begin;
+  NumLocalElems = elem_end - elem_begin;
+  const long long side_begin = (nb[side_type]*rank)/size;
+  const long long side_end   = (nb[side_type]*(rank+1))/size;
+
+  std::ifstream ifile;
+  ifile.open(fname.c_str(), std::ios::binary);
+  TEUCHOS_TEST_FOR_EXCEPTION(!ifile.is_open(), std::runtime_error, "Error! Cannot open mesh file '" << fname << "'.\n");
+
+  std::vector<int> elem_conn (NumLocalElems*NumElemNodes);
+  std::vector<long long> tmp;
+  long long elem_first = 0;
+  for (const auto& eb : layout.elems) {
+    if (eb.type!=elem_type) continue;
+
+    const long long lo = std::max(elem_first, elem_begin);
+    const long long hi = std::min(elem_first+eb.count, elem_end);
+    if (lo<hi) {
+      readGmshInts (ifile, eb.offset + (lo-elem_first)*eb.rec_len*int_size, (hi-lo)*eb.rec_len,
+                    int_size, int_size, tmp);
+      for (long long i=lo; i<hi; ++i)
+        for (int j=0; j<NumElemNodes; ++j)
+          elem_conn[(i-elem_begin)*NumElemNodes+j] = tmp[(i-lo)*eb.rec_len+eb.node_pos+j];
+    }
+    elem_first += eb.count;
+  }
+
+  // Nodes used by the local elements
+  std::vector<int> node_ids (elem_conn);
+  std::sort (node_ids.begin(), node_ids.end());
+  node_ids.erase (std::unique(node_ids.begin(), node_ids.end()), node_ids.end());
+  std::set<int> local_nodes (node_ids.begin(), node_ids.end());
+  TEUCHOS_TEST_FOR_EXCEPTION (!node_ids.empty() && node_ids.front()<1, std::runtime_error,
+      "Error! Invalid node tag " << node_ids.front() << ".\n");
+
+  // This rank's range of sides, as (id, tag, nodes) records
+  const int side_rec = 2+NumSideNodes;
+  std::vector<int> range_sides;
+  std::set<int> range_tags;
+  long long side_first = 0;
+  for (const auto& eb : layout.elems) {
+    if (eb.type!=side_type) continue;
+
+    const long long lo = std::max(side_first, side_begin);
+    const long long hi = std::min(side_first+eb.count, side_end);
+    if (lo<hi) {
+      readGmshInts (ifile, eb.offset + (lo-side_first)*eb.rec_len*int_size, (hi-lo)*eb.rec_len,
+                    int_size, int_size, tmp);
+      for (long long i=lo; i<hi; ++i) {
+        const long long* rec = &tmp[(i-lo)*eb.rec_len];
+        const int tag = eb.tag_pos>=0 ? rec[eb.tag_pos] : eb.tag; // Use first tag
+        range_sides.push_back(i+1);
+        range_sides.push_back(tag);
+        for (int j=0; j<NumSideNodes; ++j)
+          range_sides.push_back(rec[eb.node_pos+j]);
+        range_tags.insert(tag);
+      }
+    }
+    side_first += eb.count;
+  }
+
+  // Send the sides to the ranks that use all their nodes. Node n is registered, with
+  // the ranks using it, on the directory rank (n-1)%size; a side goes to the directory
+  // of its first node, which forwards it to every rank using that node.
+  Teuchos::RCP<const Teuchos_Comm> comm = commT;
+  stk::ParallelMachine mpi_comm = Albany::getMpiCommFromTeuchosComm(comm);
+
+  std::vector<std::vector<int> > send (size);
+  for (int n : node_ids) {
+    send[(n-1)%size].push_back(n);
+    send[(n-1)%size].push_back(rank);
+  }
+  std::vector<int> recv = exchangeInts (mpi_comm, rank, send);
+  std::map<int,std::vector<int> > node_ranks;
+  for (std::size_t k=0; k<recv.size(); k+=2)
+    node_ranks[recv[k]].push_back(recv[k+1]);
+
+  for (auto& s : send) s.clear();
+  for (std::size_t k=0; k<range_sides.size(); k+=side_rec) {
+    const int n0 = range_sides[k+2];
+    TEUCHOS_TEST_FOR_EXCEPTION (n0<1, std::runtime_error, "Error! Invalid node tag " << n0 << ".\n");
+    send[(n0-1)%size].insert(send[(n0-1)%size].end(), &range_sides[k], &range_sides[k]+side_rec);
+  }
+  recv = exchangeInts (mpi_comm, rank, send);
+
+  for (auto& s : send) s.clear();
+  for (std::size_t k=0; k<recv.size(); k+=side_rec) {
+    auto it = node_ranks.find(recv[k+2]);
+    if (it==node_ranks.end()) continue;
+    for (int r : it->second)
+      send[r].insert(send[r].end(), &recv[k], &recv[k]+side_rec);
+  }
+  recv = exchangeInts (mpi_comm, rank, send);
+
+  // Keep the sides whose nodes are all local
+  std::vector<int> side_conn;
+  for (std::size_t k=0; k<recv.size(); k+=side_rec) {
+    bool is_local = true;
+    for (int j=0; j<NumSideNodes && is_local; ++j)
+      is_local = local_nodes.count(recv[k+2+j])>0;
+    if (!is_local) continue;
+
+    for (int j=0; j<NumSideNodes; ++j)
+      side_conn.push_back(recv[k+2+j]);
+    side_conn.push_back(recv[k+1]);
+    localSideGIDs.push_back(recv[k]);
+  }
+  NumSides = localSideGIDs.size();
+
+  // Every rank needs all the side tags to declare the side sets
+  int num_range_tags = range_tags.size();
+  int max_tags = 0;
+  Teuchos::reduceAll<int,int>(*commT, Teuchos::REDUCE_MAX, 1, &num_range_tags, &max_tags);
+  if (max_tags>0) {
+    const int no_tag = std::numeric_limits<int>::min();
+    std::vector<int> tags_in (range_tags.begin(), range_tags.end());
+    tags_in.resize(max_tags, no_tag);
+    std::vector<int> tags_all (max_tags*size);
+    Teuchos::gatherAll<int,int>(*commT, max_tags, &tags_in[0], max_tags*size, &tags_all[0]);
+    for (int tag : tags_all)
+      if (tag!=no_tag)
+        allSideTags.insert(tag);
+  }
+
+  // Read the coordinates of the local nodes. Tags are contiguous within a node block,
+  // so runs of consecutive tags are read with a single call.
+  std::vector<GmshNodeBlock> node_blocks (layout.nodes);
+  std::sort (node_blocks.begin(), node_blocks.end(),
+             [](const GmshNodeBlock& a, const GmshNodeBlock& b) { return a.first_tag<b.first_tag; });
+
+  NumNodes = node_ids.size();
+  pts = new double[NumNodes][3];
+  localNodeGIDs = node_ids;
+  std::vector<char> buf;
+  for (int i=0; i<NumNodes; ) {
+    auto it = std::upper_bound (node_blocks.begin(), node_blocks.end(), node_ids[i],
+                                [](const long long id, const GmshNodeBlock& b) { return id<b.first_tag; });
+    TEUCHOS_TEST_FOR_EXCEPTION (it==node_blocks.begin() || node_ids[i]>=(it-1)->first_tag+(it-1)->count,
+        std::runtime_error, "Error! Node " << node_ids[i] << " not found.\n");
+    const GmshNodeBlock& blk = *(it-1);
+    const long long k0 = node_ids[i]-blk.first_tag;
+
+    int run = 1;
+    while (i+run<NumNodes && node_ids[i+run]==node_ids[i]+run && k0+run<blk.count) ++run;
+
+    readGmshInts (ifile, blk.tag_offset + k0*blk.tag_stride, run, int_size, blk.tag_stride, tmp);
+    buf.resize((run-1)*blk.xyz_stride + 3*sizeof(double));
+    ifile.seekg (blk.xyz_offset + k0*blk.xyz_stride, std::ios::beg);
+    ifile.read (&buf[0], buf.size());
+    for (int k=0; k<run; ++k) {
+      TEUCHOS_TEST_FOR_EXCEPTION (tmp[k]!=node_ids[i+k], std::runtime_error,
+          "Error! Parallel read requires node tags to be contiguous within each node block.\n");
+      std::memcpy (pts[i+k], &buf[k*blk.xyz_stride], 3*sizeof(double));
+    }
+    i += run;
+  }
+  ifile.close();
+
+  // Store the connectivity in the same layout used by the serial readers
+  lines = new int*[3];
+  tetra = new int*[5];
+  trias = new int*[5];
+  hexas = new int*[9];
+  quads = new int*[5];
+  const int nb_line  = side_type==1 ? NumSides : 0;
+  const int nb_tria  = elem_type==2 ? NumLocalElems : (side_type==2 ? NumSides : 0);
+  const int nb_quad  = elem_type==3 ? NumLocalElems : (side_type==3 ? NumSides : 0);
+  const int nb_tetra = elem_type==4 ? NumLocalElems : 0;
+  const int nb_hexa  = elem_type==5 ? NumLocalElems : 0;
+  for (int i(0); i<5; ++i) {
+    tetra[i] = new int[nb_tetra];
+  }
+  for (int i(0); i<5; ++i) {
+    trias[i] = new int[nb_tria];
+  }
+  for (int i(0); i<9; ++i) {
+    hexas[i] = new int[nb_hexa];
+  }
+  for (int i(0); i<5; ++i) {
+    quads[i] = new int[nb_quad];
+  }
+  for (int i(0); i<3; ++i) {
+    lines[i] = new int[nb_line];
+  }
+
+  switch (elem_type) {
+    case 2: elems = trias; break;
+    case 3: elems = quads; break;
+    case 4: elems = tetra; break;
+    case 5: elems = hexas; break;
+  }
+  switch (side_type) {
+    case 1: sides = lines; break;
+    case 2: sides = trias; break;
+    case 3: sides = quads; break;
+  }
+
+  for (int i=0; i<NumLocalElems; ++i)
+    for (int j=0; j<NumElemNodes; ++j)
+      elems[j][i] = elem_conn[i*NumElemNodes+j];
+
+  for (int i=0; i<NumSides; ++i)
+    for (int j=0; j<=NumSideNodes; ++j)
+      sides[j][i] = side_conn[i*(NumSideNodes+1)+j];
+}
@@ -7,6 +7,9 @@
 
 #include "Albany_GenericSTKMeshStruct.hpp"
 
+#include <set>
+#include <vector>
+
 //#include <Ionit_Initializer.h>
 
 namespace Albany
@@ -43,6 +46,18 @@ class GmshSTKMeshStruct : public GenericSTKMeshStruct
   void loadLegacyMesh (const std::string& fname);
   void loadAsciiMesh (const std::string& fname);
   void loadBinaryMesh (const std::string& fname);
+  void loadBinaryMeshParallel (const std::string& fname, const int version,
+                               const Teuchos::RCP<const Teuchos_Comm>& commT);
+
+  // Parallel read: each rank holds its own range of elements, the nodes they
+  // use, and the sides whose nodes are all among them (all counts below are
+  // then local, except NumElems which stays global)
+  bool parallelRead;
+  int firstLocalElem;
+  int NumLocalElems;
+  std::vector<int> localNodeGIDs;
+  std::vector<int> localSideGIDs;
+  std::set<int> allSideTags;
 
   int NumElemNodes; // Number of nodes per element (e.g. 3 for Triangles)
   int NumSideNodes; // Number of nodes per side (e.g. 2 for a Line)
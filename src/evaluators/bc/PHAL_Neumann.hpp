@@ -22,6 +22,9 @@
 
 #include "Albany_MaterialDatabase.hpp"
 
+#include <map>
+#include <vector>
+
 
 namespace PHAL {
 
@@ -179,6 +182,32 @@ protected:
    // Do the side integration
   void evaluateNeumannContribution(typename Traits::EvalData d);
 
+  // Cells of a workset on the side set that share the same block and local side id,
+  // together with the side geometry, which only depends on the mesh
+  struct SideGroupGeometry {
+    int ebIndex;
+    int side;
+    Kokkos::DynRankView<int, PHX::Device> cellVec;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> physPointsSide;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobianSide;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> trans_basis_refPointsSide;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_trans_basis_refPointsSide;
+  };
+
+  struct WorksetSideGeometry {
+    std::vector<int> sideKeys;       // (ebIndex, elem_LID, side_local_id) of each side
+    std::vector<RealType> coords;    // coordinates of the grouped cells, used to detect mesh motion
+    std::vector<SideGroupGeometry> groups;
+  };
+
+  bool isSideGeometryCurrent(const std::vector<Albany::SideStruct>& sideSet,
+                             const WorksetSideGeometry& geometry) const;
+  void buildSideGeometry(const std::vector<Albany::SideStruct>& sideSet,
+                         WorksetSideGeometry& geometry);
+
+  // Side geometry, by workset index
+  std::map<int, WorksetSideGeometry> sideGeometryCache;
+
   // Input:
   //! Coordinate vector at vertices
   PHX::MDField<const MeshScalarT,Cell,Vertex,Dim> coordVec;
@@ -209,12 +238,8 @@ protected:
   Kokkos::DynRankView<RealType, PHX::Device> cubWeightsSide_buffer;
   Kokkos::DynRankView<RealType, PHX::Device> basis_refPointsSide_buffer;
 
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> physPointsSide_buffer;
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobianSide_buffer;
   Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobianSide_det_buffer;
   Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_measure_buffer;
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> trans_basis_refPointsSide_buffer;
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_trans_basis_refPointsSide_buffer;
   Kokkos::DynRankView<MeshScalarT, PHX::Device> side_normals_buffer;
   Kokkos::DynRankView<MeshScalarT, PHX::Device> normal_lengths_buffer;
 
@@ -6,6 +6,7 @@
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include <string>
+#include <type_traits>
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
 #include "Sacado_ParameterRegistration.hpp"
@@ -426,12 +427,8 @@ postRegistrationSetup(typename Traits::SetupData d,
   cubWeightsSide_buffer = Kokkos::DynRankView<RealType, PHX::Device>("cubWeightsSide", maxNumQpSide);
   basis_refPointsSide_buffer = Kokkos::DynRankView<RealType, PHX::Device>("basis_refPointsSide", numNodes*maxNumQpSide);
 
-  physPointsSide_buffer = Kokkos::createDynRankView(coordVec.get_view(),"physPointsSide", numCells*maxNumQpSide*cellDims);
-  jacobianSide_buffer = Kokkos::createDynRankView(coordVec.get_view(),"jacobianSide", numCells*maxNumQpSide*cellDims*cellDims);
   jacobianSide_det_buffer = Kokkos::createDynRankView(coordVec.get_view(),"jacobianSide", numCells*maxNumQpSide);
   weighted_measure_buffer = Kokkos::createDynRankView(coordVec.get_view(),"weighted_measure", numCells*maxNumQpSide);
-  trans_basis_refPointsSide_buffer = Kokkos::createDynRankView(coordVec.get_view(),"trans_basis_refPointsSide", numCells*numNodes*maxNumQpSide);
-  weighted_trans_basis_refPointsSide_buffer = Kokkos::createDynRankView(coordVec.get_view(),"weighted_trans_basis_refPointsSide", numCells*numNodes*maxNumQpSide);
   side_normals_buffer = Kokkos::createDynRankView(coordVec.get_view(),"side_normals", numCells*maxNumQpSide*cellDims);
   normal_lengths_buffer =Kokkos::createDynRankView(coordVec.get_view(),"normal_lengths", numCells*maxNumQpSide);
 
@@ -443,6 +440,177 @@ postRegistrationSetup(typename Traits::SetupData d,
   }
 }
 
+template<typename EvalT, typename Traits>
+bool NeumannBase<EvalT, Traits>::
+isSideGeometryCurrent(const std::vector<Albany::SideStruct>& sideSet,
+                      const WorksetSideGeometry& geometry) const
+{
+  if (geometry.sideKeys.size() != 3*sideSet.size()) return false;
+
+  int i = 0;
+  for (auto const& it_side : sideSet) {
+    if (geometry.sideKeys[i++] != it_side.elem_ebIndex ||
+        geometry.sideKeys[i++] != it_side.elem_LID ||
+        geometry.sideKeys[i++] != it_side.side_local_id)
+      return false;
+  }
+
+  // Mesh motion: compare the coordinates of the cells on the side set
+  i = 0;
+  for (const SideGroupGeometry& group : geometry.groups)
+    for (int iCell=0; iCell < group.cellVec.dimension(0); ++iCell)
+      for (int node=0; node < numNodes; ++node)
+        for (int dim=0; dim < cellDims; ++dim)
+          if (geometry.coords[i++] != Albany::ADValue(coordVec(group.cellVec(iCell),node,dim)))
+            return false;
+
+  return true;
+}
+
+template<typename EvalT, typename Traits>
+void NeumannBase<EvalT, Traits>::
+buildSideGeometry(const std::vector<Albany::SideStruct>& sideSet,
+                  WorksetSideGeometry& geometry)
+{
+  using DynRankViewRealT = Kokkos::DynRankView<RealType, PHX::Device>;
+  using DynRankViewMeshScalarT = Kokkos::DynRankView<MeshScalarT, PHX::Device>;
+
+  DynRankViewRealT cubPointsSide;
+  DynRankViewRealT refPointsSide;
+  DynRankViewRealT cubWeightsSide;
+  DynRankViewRealT basis_refPointsSide;
+
+  DynRankViewMeshScalarT jacobianSide_det;
+  DynRankViewMeshScalarT weighted_measure;
+  DynRankViewMeshScalarT physPointsCell;
+
+  geometry.sideKeys.clear();
+  geometry.coords.clear();
+  geometry.groups.clear();
+
+  //! For each element block, and for each local side id (e.g. side_id=0,1,2,3,4 for a Prism) we want to identify all the physical cells associated to that side id and block.
+  //! In this way we can group them and call Intrepid2 function for a group of cells, which is more effective.
+  //! At this point we do not know the number of blocks in this workset (If we assumed to have elements of the same block in a workset we could skip some of this).
+  //! Also we do not know before the evaluator how many cells are associated to a local side id.
+
+  std::map<int, int> ordinalEbIndex;
+  std::vector<int> ebIndexVec;
+  std::vector<std::vector<int> > numCellsOnSidesOnBlocks;
+  std::vector<std::vector<Kokkos::DynRankView<int, PHX::Device> > > cellsOnSidesOnBlocks;
+  for (auto const& it_side : sideSet) {
+    const int ebIndex = it_side.elem_ebIndex;
+    const int elem_side = it_side.side_local_id;
+
+    if(ordinalEbIndex.insert(std::pair<int,int>(ebIndex,ordinalEbIndex.size())).second) {
+      numCellsOnSidesOnBlocks.push_back(std::vector<int>(numSidesOnElem, 0));
+      ebIndexVec.push_back(ebIndex);
+    }
+
+    numCellsOnSidesOnBlocks[ordinalEbIndex[ebIndex]][elem_side]++;
+
+    geometry.sideKeys.push_back(ebIndex);
+    geometry.sideKeys.push_back(it_side.elem_LID);
+    geometry.sideKeys.push_back(elem_side);
+  }
+  cellsOnSidesOnBlocks.resize(ordinalEbIndex.size());
+  for (int ib=0; ib<ordinalEbIndex.size(); ib++) {
+    cellsOnSidesOnBlocks[ib].resize(numSidesOnElem);
+    for (int is=0; is<numSidesOnElem; is++) {
+      cellsOnSidesOnBlocks[ib][is] = Kokkos::DynRankView<int, PHX::Device>("cellOnSide_i", numCellsOnSidesOnBlocks[ib][is]);
+      numCellsOnSidesOnBlocks[ib][is]=0;
+    }
+  }
+
+  for (auto const& it_side : sideSet) {
+    const int iBlock = ordinalEbIndex[it_side.elem_ebIndex];
+    const int elem_LID = it_side.elem_LID;
+    const int elem_side = it_side.side_local_id;
+
+    cellsOnSidesOnBlocks[iBlock][elem_side](numCellsOnSidesOnBlocks[iBlock][elem_side]++) = elem_LID;
+  }
+
+  for (int iblock = 0; iblock < ordinalEbIndex.size(); ++iblock)
+  for (int side = 0; side < numSidesOnElem; ++side)
+  {
+    int numCells_ =  numCellsOnSidesOnBlocks[iblock][side];
+    if( numCells_ == 0) continue;
+
+    int sideDims = sideType[side]->getDimension();
+    int numQPsSide = cubatureSide[side]->getNumPoints();
+
+    SideGroupGeometry group;
+    group.ebIndex = ebIndexVec[iblock];
+    group.side = side;
+    group.cellVec = cellsOnSidesOnBlocks[iblock][side];
+    Kokkos::DynRankView<int, PHX::Device> cellVec = group.cellVec;
+
+    // These outlive the evaluation, so they get their own storage
+    group.physPointsSide = Kokkos::createDynRankViewWithType<DynRankViewMeshScalarT>(coordVec.get_view(), "physPointsSide", numCells_, numQPsSide, cellDims);
+    group.jacobianSide = Kokkos::createDynRankViewWithType<DynRankViewMeshScalarT>(coordVec.get_view(), "jacobianSide", numCells_, numQPsSide, cellDims, cellDims);
+    group.trans_basis_refPointsSide = Kokkos::createDynRankViewWithType<DynRankViewMeshScalarT>(coordVec.get_view(), "trans_basis_refPointsSide", numCells_, numNodes, numQPsSide);
+    group.weighted_trans_basis_refPointsSide = Kokkos::createDynRankViewWithType<DynRankViewMeshScalarT>(coordVec.get_view(), "weighted_trans_basis_refPointsSide", numCells_, numNodes, numQPsSide);
+
+    //need to resize containers because they depend on side topology
+    cubPointsSide = DynRankViewRealT(cubPointsSide_buffer.data(), numQPsSide, sideDims);
+    refPointsSide = DynRankViewRealT(refPointsSide_buffer.data(), numQPsSide, cellDims);
+    cubWeightsSide = DynRankViewRealT(cubWeightsSide_buffer.data(), numQPsSide);
+    basis_refPointsSide = DynRankViewRealT(basis_refPointsSide_buffer.data(), numNodes, numQPsSide);
+
+    jacobianSide_det = Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_det_buffer, jacobianSide_det_buffer.data(), numCells_, numQPsSide);
+    weighted_measure = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_measure_buffer, weighted_measure_buffer.data(), numCells_, numQPsSide);
+    physPointsCell =Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsCell_buffer, physPointsCell_buffer.data(), numCells_, numNodes, cellDims);
+
+    cubatureSide[side]->getCubature(cubPointsSide, cubWeightsSide);
+
+    // Copy the coordinate data over to a temp container
+    for (std::size_t node=0; node < numNodes; ++node)
+      for (std::size_t dim=0; dim < cellDims; ++dim)
+        for (std::size_t iCell=0; iCell < numCells_; ++iCell)
+          physPointsCell(iCell, node, dim) = coordVec(cellVec(iCell),node,dim);
+
+    // Keep the coordinates, to detect mesh motion
+    for (std::size_t iCell=0; iCell < numCells_; ++iCell)
+      for (std::size_t node=0; node < numNodes; ++node)
+        for (std::size_t dim=0; dim < cellDims; ++dim)
+          geometry.coords.push_back(Albany::ADValue(physPointsCell(iCell, node, dim)));
+
+    // Map side cubature points to the reference parent cell based on the appropriate side (elem_side)
+    Intrepid2::CellTools<PHX::Device>::mapToReferenceSubcell
+      (refPointsSide, cubPointsSide, sideDims, side, *cellType);
+
+    // Calculate side geometry
+    Intrepid2::CellTools<PHX::Device>::setJacobian
+       (group.jacobianSide, refPointsSide, physPointsCell, *cellType);
+
+    Intrepid2::CellTools<PHX::Device>::setJacobianDet(jacobianSide_det, group.jacobianSide);
+
+    if (sideDims < 2) { //for 1 and 2D, get weighted edge measure
+      Intrepid2::FunctionSpaceTools<PHX::Device>::computeEdgeMeasure
+        (weighted_measure, group.jacobianSide, cubWeightsSide, side, *cellType, temporary_buffer);
+    }
+    else { //for 3D, get weighted face measure
+      Intrepid2::FunctionSpaceTools<PHX::Device>::computeFaceMeasure
+        (weighted_measure, group.jacobianSide, cubWeightsSide, side, *cellType, temporary_buffer);
+    }
+
+    // Values of the basis functions at side cubature points, in the reference parent cell domain
+    intrepidBasis->getValues(basis_refPointsSide, refPointsSide, Intrepid2::OPERATOR_VALUE);
+
+    // Transform values of the basis functions
+    Intrepid2::FunctionSpaceTools<PHX::Device>::HGRADtransformVALUE
+      (group.trans_basis_refPointsSide, basis_refPointsSide);
+
+    // Multiply with weighted measure
+    Intrepid2::FunctionSpaceTools<PHX::Device>::multiplyMeasure
+      (group.weighted_trans_basis_refPointsSide, weighted_measure, group.trans_basis_refPointsSide);
+
+    // Map cell (reference) cubature points to the appropriate side (elem_side) in physical space
+    Intrepid2::CellTools<PHX::Device>::mapToPhysicalFrame
+      (group.physPointsSide, refPointsSide, physPointsCell, intrepidBasis);
+
+    geometry.groups.push_back(group);
+  }
+}
 template<typename EvalT, typename Traits>
 void NeumannBase<EvalT, Traits>::
 evaluateNeumannContribution(typename Traits::EvalData workset)
@@ -532,27 +700,18 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
   const Albany::SideSetList& ssList = *(workset.sideSets);
   Albany::SideSetList::const_iterator it = ssList.find(this->sideSetID);
 
-  const std::vector<Albany::SideStruct>& sideSet = it->second;
-
   if(it == ssList.end()) return; // This sideset does not exist in this workset (GAH - this can go away
                                   // once we move logic to BCUtils
 
-  using DynRankViewRealT = Kokkos::DynRankView<RealType, PHX::Device>;
+  const std::vector<Albany::SideStruct>& sideSet = it->second;
+
   using DynRankViewMeshScalarT = Kokkos::DynRankView<MeshScalarT, PHX::Device>;
   using DynRankViewScalarT = Kokkos::DynRankView<ScalarT, PHX::Device>;
 
-  DynRankViewRealT cubPointsSide;
-  DynRankViewRealT refPointsSide;
-  DynRankViewRealT cubWeightsSide;
-  DynRankViewRealT basis_refPointsSide;
-
   DynRankViewMeshScalarT physPointsSide;
   DynRankViewMeshScalarT jacobianSide;
-  DynRankViewMeshScalarT jacobianSide_det;
-  DynRankViewMeshScalarT weighted_measure;
   DynRankViewMeshScalarT trans_basis_refPointsSide;
   DynRankViewMeshScalarT weighted_trans_basis_refPointsSide;
-  DynRankViewMeshScalarT physPointsCell;
 
   DynRankViewScalarT betaOnSide;
   DynRankViewScalarT thicknessOnSide;
@@ -565,115 +724,32 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
 
   DynRankViewScalarT data;
 
-  //! For each element block, and for each local side id (e.g. side_id=0,1,2,3,4 for a Prism) we want to identify all the physical cells associated to that side id and block.
-  //! In this way we can group them and call Intrepid2 function for a group of cells, which is more effective.
-  //! At this point we do not know the number of blocks in this workset (If we assumed to have elements of the same block in a workset we could skip some of this).
-  //! Also we do not know before the evaluator how many cells are associated to a local side id.
-
-  std::map<int, int> ordinalEbIndex;
-  std::vector<int> ebIndexVec;
-  std::vector<std::vector<int> > numCellsOnSidesOnBlocks;
-  std::vector<std::vector<Kokkos::DynRankView<int, PHX::Device> > > cellsOnSidesOnBlocks;
-  for (auto const& it_side : sideSet) {
-    const int ebIndex = it_side.elem_ebIndex;
-    const int elem_LID = it_side.elem_LID;
-    const int elem_side = it_side.side_local_id;
-
-    if(ordinalEbIndex.insert(std::pair<int,int>(ebIndex,ordinalEbIndex.size())).second) {
-      numCellsOnSidesOnBlocks.push_back(std::vector<int>(numSidesOnElem, 0));
-      ebIndexVec.push_back(ebIndex);
-    }
-
-    numCellsOnSidesOnBlocks[ordinalEbIndex[ebIndex]][elem_side]++;
-  }
-  cellsOnSidesOnBlocks.resize(ordinalEbIndex.size());
-  for (int ib=0; ib<ordinalEbIndex.size(); ib++) {
-    cellsOnSidesOnBlocks[ib].resize(numSidesOnElem);
-    for (int is=0; is<numSidesOnElem; is++) {
-      cellsOnSidesOnBlocks[ib][is] = Kokkos::DynRankView<int, PHX::Device>("cellOnSide_i", numCellsOnSidesOnBlocks[ib][is]);
-      numCellsOnSidesOnBlocks[ib][is]=0;
-    }
+  // The grouping of the cells and the side geometry only depend on the mesh, so they are
+  // kept per workset and reused until the side set or the coordinates change. When the
+  // coordinates carry derivatives the geometry is recomputed at every evaluation.
+  WorksetSideGeometry localGeometry;
+  WorksetSideGeometry* geometry = &localGeometry;
+  if (std::is_same<MeshScalarT,RealType>::value) {
+    geometry = &sideGeometryCache[workset.wsIndex];
+    if (!isSideGeometryCurrent(sideSet, *geometry))
+      buildSideGeometry(sideSet, *geometry);
+  } else {
+    buildSideGeometry(sideSet, localGeometry);
   }
 
-  for (auto const& it_side : sideSet) {
-    const int iBlock = ordinalEbIndex[it_side.elem_ebIndex];
-    const int elem_LID = it_side.elem_LID;
-    const int elem_side = it_side.side_local_id;
-
-    cellsOnSidesOnBlocks[iBlock][elem_side](numCellsOnSidesOnBlocks[iBlock][elem_side]++) = elem_LID;
-  }
-
-  // Loop over the sides that form the boundary condition
-  for (int iblock = 0; iblock < ordinalEbIndex.size(); ++iblock)
-  for (int side = 0; side < numSidesOnElem; ++side)
+  // Loop over the groups of cells sharing the same block and local side id
+  for (const SideGroupGeometry& group : geometry->groups)
   {
-    int numCells_ =  numCellsOnSidesOnBlocks[iblock][side];
-    if( numCells_ == 0) continue;
-
-    // Get the data that corresponds to the side
-
-    int sideDims = sideType[side]->getDimension();
-    int numQPsSide = cubatureSide[side]->getNumPoints();
-
-    Kokkos::DynRankView<int, PHX::Device> cellVec  = cellsOnSidesOnBlocks[iblock][side];
-
-    //need to resize containers because they depend on side topology
-    cubPointsSide = DynRankViewRealT(cubPointsSide_buffer.data(), numQPsSide, sideDims);
-    refPointsSide = DynRankViewRealT(refPointsSide_buffer.data(), numQPsSide, cellDims);
-    cubWeightsSide = DynRankViewRealT(cubWeightsSide_buffer.data(), numQPsSide);
-    basis_refPointsSide = DynRankViewRealT(basis_refPointsSide_buffer.data(), numNodes, numQPsSide);
-
-    physPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsSide_buffer, physPointsSide_buffer.data(), numCells_, numQPsSide, cellDims);
-    jacobianSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_buffer, jacobianSide_buffer.data(), numCells_, numQPsSide, cellDims, cellDims);
-    jacobianSide_det = Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_det_buffer, jacobianSide_det_buffer.data(), numCells_, numQPsSide);
-    weighted_measure = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_measure_buffer, weighted_measure_buffer.data(), numCells_, numQPsSide);
-    trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(trans_basis_refPointsSide_buffer, trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPsSide);
-    weighted_trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_trans_basis_refPointsSide_buffer, weighted_trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPsSide);
-    physPointsCell =Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsCell_buffer, physPointsCell_buffer.data(), numCells_, numNodes, cellDims);
-
-
-    cubatureSide[side]->getCubature(cubPointsSide, cubWeightsSide);
-
-    // Copy the coordinate data over to a temp container
-    for (std::size_t node=0; node < numNodes; ++node)
-      for (std::size_t dim=0; dim < cellDims; ++dim)
-        for (std::size_t iCell=0; iCell < numCells_; ++iCell)
-          physPointsCell(iCell, node, dim) = coordVec(cellVec(iCell),node,dim);
-
-    // Map side cubature points to the reference parent cell based on the appropriate side (elem_side)
-    Intrepid2::CellTools<PHX::Device>::mapToReferenceSubcell
-      (refPointsSide, cubPointsSide, sideDims, side, *cellType);
-
-    // Calculate side geometry
-    Intrepid2::CellTools<PHX::Device>::setJacobian
-       (jacobianSide, refPointsSide, physPointsCell, *cellType);
-
-    Intrepid2::CellTools<PHX::Device>::setJacobianDet(jacobianSide_det, jacobianSide);
-
-    if (sideDims < 2) { //for 1 and 2D, get weighted edge measure
-      Intrepid2::FunctionSpaceTools<PHX::Device>::computeEdgeMeasure
-        (weighted_measure, jacobianSide, cubWeightsSide, side, *cellType, temporary_buffer);
-    }
-    else { //for 3D, get weighted face measure
-      Intrepid2::FunctionSpaceTools<PHX::Device>::computeFaceMeasure
-        (weighted_measure, jacobianSide, cubWeightsSide, side, *cellType, temporary_buffer);
-    }
-
-    // Values of the basis functions at side cubature points, in the reference parent cell domain
-    intrepidBasis->getValues(basis_refPointsSide, refPointsSide, Intrepid2::OPERATOR_VALUE);
-
-    // Transform values of the basis functions
-    Intrepid2::FunctionSpaceTools<PHX::Device>::HGRADtransformVALUE
-      (trans_basis_refPointsSide, basis_refPointsSide);
+    const int side = group.side;
+    const int numCells_ = group.cellVec.dimension(0);
+    const int numQPsSide = cubatureSide[side]->getNumPoints();
 
-    // Multiply with weighted measure
-    Intrepid2::FunctionSpaceTools<PHX::Device>::multiplyMeasure
-      (weighted_trans_basis_refPointsSide, weighted_measure, trans_basis_refPointsSide);
-
-    // Map cell (reference) cubature points to the appropriate side (elem_side) in physical space
-    Intrepid2::CellTools<PHX::Device>::mapToPhysicalFrame
-      (physPointsSide, refPointsSide, physPointsCell, intrepidBasis);
+    Kokkos::DynRankView<int, PHX::Device> cellVec = group.cellVec;
 
+    physPointsSide = group.physPointsSide;
+    jacobianSide = group.jacobianSide;
+    trans_basis_refPointsSide = group.trans_basis_refPointsSide;
+    weighted_trans_basis_refPointsSide = group.weighted_trans_basis_refPointsSide;
 
     // Map cell (reference) degree of freedom points to the appropriate side (elem_side)
     if(bc_type == ROBIN || bc_type == STEFAN_BOLTZMANN ) {
@@ -794,21 +870,21 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
 
       case INTJUMP:
        {
-         const ScalarT elem_scale = matScaling[ebIndexVec[iblock]];
+         const ScalarT elem_scale = matScaling[group.ebIndex];
          calc_dudn_const(data, physPointsSide, jacobianSide, *cellType, cellDims, side, elem_scale);
          break;
        }
 
       case ROBIN:
        {
-         const ScalarT elem_scale = matScaling[ebIndexVec[iblock]];
+         const ScalarT elem_scale = matScaling[group.ebIndex];
          calc_dudn_robin(data, physPointsSide, dofSide, jacobianSide, *cellType, cellDims, side, elem_scale, robin_vals);
          break;
        }
 
       case STEFAN_BOLTZMANN:
        {
-         const ScalarT elem_scale = matScaling[ebIndexVec[iblock]];
+         const ScalarT elem_scale = matScaling[group.ebIndex];
          calc_dudn_radiate(data, physPointsSide, dofSide, jacobianSide, *cellType, cellDims, side, elem_scale, robin_vals);
          break;
        }
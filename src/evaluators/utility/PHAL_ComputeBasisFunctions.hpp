@@ -18,6 +18,9 @@
 #include "Intrepid2_CellTools.hpp"
 #include "Intrepid2_Cubature.hpp"
 
+#include <map>
+#include <vector>
+
 namespace PHAL {
 
 /** \brief Finite Element Interpolation Evaluator
@@ -45,6 +48,16 @@ private:
   int  numVertices, numDims, numNodes, numQPs, numCells;
   MDFieldMemoizer<Traits> memoizer;
 
+  // Geometry cache: the geometric outputs of each workset are stored together
+  // with the coordinates they were computed from, and reused as long as the
+  // coordinates do not change (no mesh motion, no adaptation).
+  int geometryCacheSize;  // max number of cached worksets (0: disabled, -1: all)
+  std::map<int,std::vector<MeshScalarT> > geometryCache;
+
+  bool restoreCachedGeometry (const int wsIndex);
+  void storeCachedGeometry (const int wsIndex);
+  void copyGeometry (std::vector<MeshScalarT>& data, const bool toCache);
+
   // Input:
   //! Coordinate vector at vertices
   PHX::MDField<const MeshScalarT,Cell,Vertex,Dim> coordVec;
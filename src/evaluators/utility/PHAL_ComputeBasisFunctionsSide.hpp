@@ -18,6 +18,9 @@
 #include "Intrepid2_CellTools.hpp"
 #include "Intrepid2_Cubature.hpp"
 
+#include <map>
+#include <vector>
+
 namespace PHAL {
 
 /** \brief Finite Element Interpolation Evaluator
@@ -45,6 +48,17 @@ private:
   int numSides, numSideNodes, numSideQPs, numCellDims, numSideDims, numNodes;
   MDFieldMemoizer<Traits> memoizer;
 
+  // Geometry cache: see ComputeBasisFunctions. Entries store the side geometry
+  // of the side set cells of a workset, in side set order.
+  int geometryCacheSize;  // max number of cached worksets (0: disabled, -1: all)
+  std::map<int,std::vector<MeshScalarT> > geometryCache;
+
+  bool restoreCachedGeometry (typename Traits::EvalData workset);
+  void storeCachedGeometry (typename Traits::EvalData workset);
+  std::size_t cachedGeometrySize (const std::size_t numSideCells, const bool coordsOnly) const;
+  void copyGeometry (typename Traits::EvalData workset,
+                     std::vector<MeshScalarT>& data, const bool toCache);
+
   //! The side set where to compute the Basis Functions
   std::string sideSetName;
 
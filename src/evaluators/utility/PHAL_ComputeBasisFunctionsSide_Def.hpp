@@ -9,6 +9,8 @@
 #include "Phalanx_DataLayout.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
+
+#include <type_traits>
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
 
@@ -23,6 +25,11 @@ ComputeBasisFunctionsSide (const Teuchos::ParameterList& p,
     memoizer.enable_memoizer();
   }
 
+  // Caching is only safe if the geometry does not carry derivatives
+  geometryCacheSize = p.isType<int>("Geometry Cache Size") ? p.get<int>("Geometry Cache Size") : 0;
+  if (!std::is_same<MeshScalarT,RealType>::value)
+    geometryCacheSize = 0;
+
   // Get side set name and side set layouts
   sideSetName = p.get<std::string>("Side Set Name");
   TEUCHOS_TEST_FOR_EXCEPTION (dl->side_layouts.find(sideSetName)==dl->side_layouts.end(),
@@ -151,6 +158,8 @@ evaluateFields(typename Traits::EvalData workset)
   if (workset.sideSets->find(sideSetName)==workset.sideSets->end())
     return;
 
+  if (geometryCacheSize!=0 && restoreCachedGeometry(workset)) return;
+
   numCellsOnSide.assign(numSides, 0);
   const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(sideSetName);
   for (auto const& it_side : sideSet)
@@ -283,6 +292,135 @@ evaluateFields(typename Traits::EvalData workset)
             normals(cellVec(iCell),side,qp, icoor) = normals_view(iCell,qp,icoor);
     }
   }
+
+  if (geometryCacheSize!=0)
+    storeCachedGeometry(workset);
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+bool ComputeBasisFunctionsSide<EvalT, Traits>::
+restoreCachedGeometry (typename Traits::EvalData workset)
+{
+  auto it = geometryCache.find(workset.wsIndex);
+  if (it==geometryCache.end())
+    return false;
+
+  const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(sideSetName);
+  std::vector<MeshScalarT>& data = it->second;
+  if (data.size()!=cachedGeometrySize(sideSet.size(),false))
+    return false;
+
+  // Any change in the coordinates (mesh motion, adaptation) invalidates the entry
+  std::size_t k = 0;
+  for (auto const& it_side : sideSet)
+  {
+    const int cell = it_side.elem_LID;
+    const int side = it_side.side_local_id;
+    for (int node=0; node<numSideNodes; ++node)
+      for (int dim=0; dim<numCellDims; ++dim)
+        if (data[k++]!=sideCoordVec(cell,side,node,dim))
+          return false;
+    if (compute_normals)
+      for (int node=0; node<numNodes; ++node)
+        for (int dim=0; dim<numCellDims; ++dim)
+          if (data[k++]!=coordVec(cell,node,dim))
+            return false;
+  }
+
+  copyGeometry(workset,data,false);
+
+  return true;
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void ComputeBasisFunctionsSide<EvalT, Traits>::
+storeCachedGeometry (typename Traits::EvalData workset)
+{
+  if (geometryCache.find(workset.wsIndex)==geometryCache.end() &&
+      geometryCacheSize>0 && static_cast<int>(geometryCache.size())>=geometryCacheSize)
+    return;
+
+  const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(sideSetName);
+  std::vector<MeshScalarT>& data = geometryCache[workset.wsIndex];
+  data.clear();
+
+  for (auto const& it_side : sideSet)
+  {
+    const int cell = it_side.elem_LID;
+    const int side = it_side.side_local_id;
+    for (int node=0; node<numSideNodes; ++node)
+      for (int dim=0; dim<numCellDims; ++dim)
+        data.push_back(sideCoordVec(cell,side,node,dim));
+    if (compute_normals)
+      for (int node=0; node<numNodes; ++node)
+        for (int dim=0; dim<numCellDims; ++dim)
+          data.push_back(coordVec(cell,node,dim));
+  }
+
+  copyGeometry(workset,data,true);
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+std::size_t ComputeBasisFunctionsSide<EvalT, Traits>::
+cachedGeometrySize (const std::size_t numSideCells, const bool coordsOnly) const
+{
+  const std::size_t coordsSize = numSideCells*numCellDims*(numSideNodes + (compute_normals ? numNodes : 0));
+  if (coordsOnly)
+    return coordsSize;
+
+  return coordsSize + numSideCells*numSideQPs*(2 + numCellDims*numSideDims + 2*numSideDims*numSideDims
+                                               + numSideNodes*numSideDims + (compute_normals ? numCellDims : 0));
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void ComputeBasisFunctionsSide<EvalT, Traits>::
+copyGeometry (typename Traits::EvalData workset,
+              std::vector<MeshScalarT>& data, const bool toCache)
+{
+  const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(sideSetName);
+
+  // The coordinates are stored first
+  std::size_t k = cachedGeometrySize(sideSet.size(),true);
+  if (toCache)
+    data.resize(cachedGeometrySize(sideSet.size(),false));
+
+  auto copy = [&](MeshScalarT& val) {
+    if (toCache)
+      data[k] = val;
+    else
+      val = data[k];
+    ++k;
+  };
+
+  for (auto const& it_side : sideSet)
+  {
+    const int cell = it_side.elem_LID;
+    const int side = it_side.side_local_id;
+    for (int qp=0; qp<numSideQPs; ++qp)
+    {
+      copy(metric_det(cell,side,qp));
+      copy(w_measure(cell,side,qp));
+      for (int icoor=0; icoor<numCellDims; ++icoor)
+        for (int itan=0; itan<numSideDims; ++itan)
+          copy(tangents(cell,side,qp,icoor,itan));
+      for (int idim=0; idim<numSideDims; ++idim)
+        for (int jdim=0; jdim<numSideDims; ++jdim)
+        {
+          copy(metric(cell,side,qp,idim,jdim));
+          copy(inv_metric(cell,side,qp,idim,jdim));
+        }
+      for (int node=0; node<numSideNodes; ++node)
+        for (int ider=0; ider<numSideDims; ++ider)
+          copy(GradBF(cell,side,node,qp,ider));
+      if (compute_normals)
+        for (int icoor=0; icoor<numCellDims; ++icoor)
+          copy(normals(cell,side,qp,icoor));
+    }
+  }
 }
 
 } // Namespace PHAL
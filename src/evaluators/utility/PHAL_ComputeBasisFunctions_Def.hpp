@@ -9,6 +9,8 @@
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
 
+#include <type_traits>
+
 namespace PHAL {
 
 template<typename EvalT, typename Traits>
@@ -29,6 +31,11 @@ ComputeBasisFunctions(const Teuchos::ParameterList& p,
   if (p.isType<bool>("Enable Memoizer") && p.get<bool>("Enable Memoizer"))
     memoizer.enable_memoizer();
 
+  // Caching is only safe if the geometry does not carry derivatives
+  geometryCacheSize = p.isType<int>("Geometry Cache Size") ? p.get<int>("Geometry Cache Size") : 0;
+  if (!std::is_same<MeshScalarT,RealType>::value)
+    geometryCacheSize = 0;
+
   this->addDependentField(coordVec.fieldTag());
   this->addEvaluatedField(weighted_measure);
   this->addEvaluatedField(jacobian_det);
@@ -91,6 +98,8 @@ evaluateFields(typename Traits::EvalData workset)
 {
   if (memoizer.have_stored_data(workset)) return;
 
+  if (geometryCacheSize!=0 && restoreCachedGeometry(workset.wsIndex)) return;
+
   /** The allocated size of the Field Containers must currently
     * match the full workset size of the allocated PHX Fields,
     * this is the size that is used in the computation. There is
@@ -114,6 +123,84 @@ evaluateFields(typename Traits::EvalData workset)
   IFST::multiplyMeasure    (wGradBF.get_view(), weighted_measure.get_view(), GradBF.get_view());
 
   (void)isJacobianDetNegative;
+
+  if (geometryCacheSize!=0)
+    storeCachedGeometry(workset.wsIndex);
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+bool ComputeBasisFunctions<EvalT, Traits>::
+restoreCachedGeometry (const int wsIndex)
+{
+  auto it = geometryCache.find(wsIndex);
+  if (it==geometryCache.end())
+    return false;
+
+  // Any change in the coordinates (mesh motion, adaptation) invalidates the entry
+  std::vector<MeshScalarT>& data = it->second;
+  std::size_t k = 0;
+  for (int cell=0; cell<numCells; ++cell)
+    for (int v=0; v<numVertices; ++v)
+      for (int dim=0; dim<numDims; ++dim)
+        if (data[k++]!=coordVec(cell,v,dim))
+          return false;
+
+  copyGeometry(data,false);
+  Intrepid2::FunctionSpaceTools<PHX::Device>::HGRADtransformVALUE(BF.get_view(), val_at_cub_points);
+
+  return true;
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void ComputeBasisFunctions<EvalT, Traits>::
+storeCachedGeometry (const int wsIndex)
+{
+  if (geometryCache.find(wsIndex)==geometryCache.end() &&
+      geometryCacheSize>0 && static_cast<int>(geometryCache.size())>=geometryCacheSize)
+    return;
+
+  std::vector<MeshScalarT>& data = geometryCache[wsIndex];
+  data.resize(numCells*(numVertices*numDims + numQPs*(2 + numNodes*(1 + 2*numDims))));
+
+  std::size_t k = 0;
+  for (int cell=0; cell<numCells; ++cell)
+    for (int v=0; v<numVertices; ++v)
+      for (int dim=0; dim<numDims; ++dim)
+        data[k++] = coordVec(cell,v,dim);
+
+  copyGeometry(data,true);
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void ComputeBasisFunctions<EvalT, Traits>::
+copyGeometry (std::vector<MeshScalarT>& data, const bool toCache)
+{
+  // The coordinates are stored first
+  std::size_t k = numCells*numVertices*numDims;
+  auto copy = [&](MeshScalarT& val) {
+    if (toCache)
+      data[k] = val;
+    else
+      val = data[k];
+    ++k;
+  };
+
+  for (int cell=0; cell<numCells; ++cell) {
+    for (int qp=0; qp<numQPs; ++qp) {
+      copy(weighted_measure(cell,qp));
+      copy(jacobian_det(cell,qp));
+      for (int node=0; node<numNodes; ++node) {
+        copy(wBF(cell,node,qp));
+        for (int dim=0; dim<numDims; ++dim) {
+          copy(GradBF(cell,node,qp,dim));
+          copy(wGradBF(cell,node,qp,dim));
+        }
+      }
+    }
+  }
 }
 
 //**********************************************************************
@@ -154,6 +154,10 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
   validPL->set<int>("Number Of Time Derivatives", 1, "Number of time derivatives in use in the problem");
 
   validPL->set<bool>("Use MDField Memoization", false, "Use memoizer optimization to avoid recomputing MDFields (currently only works for FELIX)");
+  validPL->sublist("AD Matrix-Free Jacobian", false,
+                   "Exact Jacobian-vector products from the Tangent fill, with a lagged assembled preconditioner");
+  validPL->set<bool>("Capture States In Residual", false,
+                     "Save the states during residual evaluations, so that observing a converged solution does not reevaluate them");
   validPL->set<bool>("Ignore Residual In Jacobian", false,
                      "Ignore residual calculations while computing the Jacobian (only generally appropriate for linear problems)");
   validPL->set<double>("Perturb Dirichlet", 0.0,
@@ -327,7 +327,8 @@ namespace Albany {
         const Teuchos::RCP<shards::CellTopology>& cellType,
         const Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > intrepidBasis,
         const Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubature,
-        const bool enableMemoizer = false) const;
+        const bool enableMemoizer = false,
+        const int geometryCacheSize = 0) const;
 
     //! Function to create parameter list for construction of ComputeBasisFunctionsSide
     //! evaluator with standard Field names
@@ -338,7 +339,8 @@ namespace Albany {
         const Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubatureSide,
         const std::string& sideSetName,
         const bool enableMemoizer = false,
-        const bool buildNormals = false) const;
+        const bool buildNormals = false,
+        const int geometryCacheSize = 0) const;
 
   private:
 
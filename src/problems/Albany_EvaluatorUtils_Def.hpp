@@ -497,7 +497,8 @@ Albany::EvaluatorUtilsBase<EvalT,Traits,ScalarT>::constructComputeBasisFunctions
     const Teuchos::RCP<shards::CellTopology>& cellType,
     const Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > intrepidBasis,
     const Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubature,
-    const bool enableMemoizer) const
+    const bool enableMemoizer,
+    const int geometryCacheSize) const
 {
     using Teuchos::RCP;
     using Teuchos::rcp;
@@ -525,6 +526,7 @@ Albany::EvaluatorUtilsBase<EvalT,Traits,ScalarT>::constructComputeBasisFunctions
     p->set<std::string>("Weighted Gradient BF Name", weighted_grad_bf_name);
 
     if (enableMemoizer) p->set<bool>("Enable Memoizer", enableMemoizer);
+    if (geometryCacheSize!=0) p->set<int>("Geometry Cache Size", geometryCacheSize);
 
     return rcp(new PHAL::ComputeBasisFunctions<EvalT,Traits>(*p,dl));
 }
@@ -537,7 +539,8 @@ Albany::EvaluatorUtilsBase<EvalT,Traits,ScalarT>::constructComputeBasisFunctions
     const Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubatureSide,
     const std::string& sideSetName,
     const bool enableMemoizer,
-    const bool buildNormals) const
+    const bool buildNormals,
+    const int geometryCacheSize) const
 {
     TEUCHOS_TEST_FOR_EXCEPTION (dl->side_layouts.find(sideSetName)==dl->side_layouts.end(), std::runtime_error,
                                 "Error! The layout structure for side set " << sideSetName << " was not found.\n");
@@ -570,6 +573,7 @@ Albany::EvaluatorUtilsBase<EvalT,Traits,ScalarT>::constructComputeBasisFunctions
     }
 
     if (enableMemoizer) p->set<bool>("Enable Memoizer", enableMemoizer);
+    if (geometryCacheSize!=0) p->set<int>("Geometry Cache Size", geometryCacheSize);
 
     return rcp(new PHAL::ComputeBasisFunctionsSide<EvalT,Traits>(*p,dl));
 }
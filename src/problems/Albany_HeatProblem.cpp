@@ -192,6 +192,7 @@ Albany::HeatProblem::getValidProblemParameters() const
   validPL->set("Convection Velocity", "{0,0,0}", "");
   validPL->set<bool>("Have Rho Cp", false, "Flag to indicate if rhoCp is used");
   validPL->set<std::string>("MaterialDB Filename","materials.xml","Filename of material database xml file");
+  validPL->set<int>("Geometry Cache Size", 0, "Number of worksets whose basis function geometry is cached while the coordinates do not change (0: disabled, -1: all worksets)");
 
   return validPL;
 }
@@ -199,7 +199,8 @@ Albany::HeatProblem::constructEvaluators(
     (evalUtils.constructMapToPhysicalFrameEvaluator( cellType, cellCubature));
 
   fm0.template registerEvaluator<EvalT>
-    (evalUtils.constructComputeBasisFunctionsEvaluator(cellType, intrepidBasis, cellCubature));
+    (evalUtils.constructComputeBasisFunctionsEvaluator(cellType, intrepidBasis, cellCubature,
+                                                        false, params->get<int>("Geometry Cache Size", 0)));
 
   for (unsigned int i=0; i<neq; i++) {
     fm0.template registerEvaluator<EvalT>
@@ -7,6 +7,8 @@ from subprocess import Popen
 
 name = "cuboid"
 log_file_name = name + ".log"
+if len(sys.argv) > 1:
+    log_file_name = sys.argv[1]
 result = 0
 
 with open(log_file_name, 'r') as log_file:
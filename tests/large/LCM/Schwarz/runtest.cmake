@@ -14,8 +14,7 @@ if(HAD_ERROR)
 	message(FATAL_ERROR "Albany didn't run: test failed")
 endif()
 
-EXECUTE_PROCESS(COMMAND python
-                INPUT_FILE ${PY_FILE}
+EXECUTE_PROCESS(COMMAND python ${PY_FILE} ${LOGFILE}
                 RESULT_VARIABLE PY_ERROR)
 if(PY_ERROR)
         message(FATAL_ERROR "Python step failed")
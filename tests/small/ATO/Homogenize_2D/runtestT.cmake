@@ -1,5 +1,9 @@
 # 1. Run the program and generate the exodus output
 
+if(NOT DEFINED OUTPUT_NAME)
+	SET(OUTPUT_NAME physics_0_mitchellT.exo)
+endif()
+
 message("Running the command:")
 message("${TEST_PROG} " " ${TEST_ARGS}")
 
@@ -18,7 +22,7 @@ if(DEFINED MPIMNP AND ${MPIMNP} GREATER 1)
 		message(FATAL_ERROR "Cannot find epu")
 	endif()
 
-	SET(EPU_COMMAND ${SEACAS_EPU} -auto physics_0_mitchellT.exo.${MPIMNP}.0)
+	SET(EPU_COMMAND ${SEACAS_EPU} -auto ${OUTPUT_NAME}.${MPIMNP}.0)
 
   message("Running the command:")
   message("${EPU_COMMAND}")
@@ -40,9 +44,9 @@ if (NOT SEACAS_EXODIFF)
 endif()
 
 if(DEFINED MPIMNP AND ${MPIMNP} GREATER 1)
-  SET(EXODIFF_TEST ${SEACAS_EXODIFF} -i -m -f ${DATA_DIR}/${TEST_NAME}.exodiff_commands physics_0_mitchellT.exo ${DATA_DIR}/${TEST_NAME}.ref.exo)
+  SET(EXODIFF_TEST ${SEACAS_EXODIFF} -i -m -f ${DATA_DIR}/${TEST_NAME}.exodiff_commands ${OUTPUT_NAME} ${DATA_DIR}/${TEST_NAME}.ref.exo)
 ELSE()
-  SET(EXODIFF_TEST ${SEACAS_EXODIFF} -i -f ${DATA_DIR}/${TEST_NAME}.exodiff_commands physics_0_mitchellT.exo ${DATA_DIR}/${TEST_NAME}.ref.exo)
+  SET(EXODIFF_TEST ${SEACAS_EXODIFF} -i -f ${DATA_DIR}/${TEST_NAME}.exodiff_commands ${OUTPUT_NAME} ${DATA_DIR}/${TEST_NAME}.ref.exo)
 ENDIF()
 
 message("Running the command:")